@@ -7,26 +7,36 @@
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
 #include <bleak/binarray.hpp>
+#include <bleak/bitboard.hpp>
 #include <bleak/bitdef.hpp>
+#include <bleak/bucket.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
 #include <bleak/circle.hpp>
 #include <bleak/clip_pool.hpp>
 #include <bleak/clock.hpp>
 #include <bleak/color.hpp>
+#include <bleak/component_map.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/constants.hpp>
 #include <bleak/creeper.hpp>
 #include <bleak/cursor.hpp>
+#include <bleak/dense_area.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/field.hpp>
+#include <bleak/field_set.hpp>
+#include <bleak/flow_field.hpp>
+#include <bleak/fov_batch.hpp>
+#include <bleak/fov_cache.hpp>
 #include <bleak/glyph.hpp>
 #include <bleak/hash.hpp>
 #include <bleak/input.hpp>
 #include <bleak/iter.hpp>
+#include <bleak/jump_table.hpp>
 #include <bleak/keyboard.hpp>
 #include <bleak/keyframe.hpp>
 #include <bleak/leaf.hpp>
+#include <bleak/light_map.hpp>
 #include <bleak/line.hpp>
 #include <bleak/log.hpp>
 #include <bleak/lut.hpp>
@@ -37,6 +47,10 @@
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/path.hpp>
+#include <bleak/path_batch.hpp>
+#include <bleak/path_cache.hpp>
+#include <bleak/path_context.hpp>
+#include <bleak/path_search.hpp>
 #include <bleak/primitive_types.hpp>
 #include <bleak/primitive.hpp>
 #include <bleak/priority_mutex.hpp>
@@ -44,15 +58,20 @@
 #include <bleak/random.hpp>
 #include <bleak/rect.hpp>
 #include <bleak/region.hpp>
+#include <bleak/region_graph.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/sample_index.hpp>
 #include <bleak/saturate.hpp>
+#include <bleak/shadowcaster.hpp>
 #include <bleak/sound.hpp>
 #include <bleak/sparse.hpp>
 #include <bleak/sprite.hpp>
 #include <bleak/steam.hpp>
 #include <bleak/subsystem.hpp>
+#include <bleak/summed_area.hpp>
 #include <bleak/text.hpp>
 #include <bleak/texture.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/timer.hpp>
 #include <bleak/tree.hpp>
 #include <bleak/triangle.hpp>
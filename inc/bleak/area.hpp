@@ -2,22 +2,23 @@
 
 #include <bleak/typedef.hpp>
 
-#include <cmath>
+#include <algorithm>
 #include <queue>
 #include <random>
 #include <unordered_set>
 #include <vector>
 
 #include <bleak/arc.hpp>
+#include <bleak/bitboard.hpp>
 #include <bleak/circle.hpp>
+#include <bleak/component_map.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/extent.hpp>
-#include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/shadowcaster.hpp>
 #include <bleak/zone.hpp>
 
 #include <bleak/constants/numeric.hpp>
-#include <bleak/constants/octants.hpp>
 
 namespace bleak {
 	class area_t : public std::unordered_set<offset_t, offset_t::std_hasher> {
@@ -69,43 +70,7 @@ namespace bleak {
 				clear();
 			}
 
-			if (!zone.dependent within<region_e::All>(position) || zone[position] != value) {
-				return *this;
-			}
-
-			std::queue<offset_t> frontier{};
-
-			frontier.push(position);
-			insert(position);
-
-			while (!frontier.empty()) {
-				const offset_t current{ frontier.front() };
-				frontier.pop();
-
-				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
-					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
-						if (x == 0 && y == 0) {
-							continue;
-						}
-
-						const offset_t neighbour{ current.x + x, current.y + y };
-
-						if (!zone.dependent within<region_e::All>(neighbour) || contains(neighbour)) {
-							continue;
-						}
-
-						if (inclusive && zone[neighbour] != value) {
-							insert(neighbour);
-							continue;
-						} else if (zone[neighbour] != value) {
-							continue;
-						}
-
-						frontier.push(neighbour);
-						insert(current);
-					}
-				}
-			}
+			scan_fill(zone, position, value, inclusive);
 
 			return *this;
 		}
@@ -117,43 +82,7 @@ namespace bleak {
 				clear();
 			}
 
-			if (!zone.dependent within<region_e::All>(position) || zone[position] != value) {
-				return *this;
-			}
-
-			std::queue<offset_t> frontier{};
-
-			frontier.push(position);
-			insert(position);
-
-			while (!frontier.empty()) {
-				const offset_t current{ std::move(frontier.front()) };
-				frontier.pop();
-
-				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
-					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
-						if (x == 0 && y == 0) {
-							continue;
-						}
-
-						const offset_t neighbour{ current.x + x, current.y + y };
-
-						if (!zone.dependent within<region_e::All>(neighbour) || contains(neighbour)) {
-							continue;
-						}
-
-						if (inclusive && zone[neighbour] != value) {
-							insert(neighbour);
-							continue;
-						} else if (zone[neighbour] != value) {
-							continue;
-						}
-
-						frontier.push(neighbour);
-						insert(neighbour);
-					}
-				}
-			}
+			scan_fill(zone, position, value, inclusive);
 
 			return *this;
 		}
@@ -164,43 +93,7 @@ namespace bleak {
 				clear();
 			}
 
-			if (!zone.dependent within<region_e::All>(position) || zone[position] != value) {
-				return *this;
-			}
-
-			std::queue<creeper_t<f32>> frontier{};
-
-			frontier.push({ position, 0.0f });
-			insert(position);
-
-			while (!frontier.empty()) {
-				const creeper_t current{ frontier.front() };
-				frontier.pop();
-
-				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
-					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
-						if (x == 0 && y == 0) {
-							continue;
-						}
-
-						const offset_t neighbour{ current.position.x + x, current.position.y + y };
-
-						if (!zone.dependent within<region_e::All>(neighbour) || contains(neighbour) || current.distance > distance) {
-							continue;
-						}
-
-						if (inclusive && zone[neighbour] != value) {
-							insert(neighbour);
-							continue;
-						} else if (zone[neighbour] != value) {
-							continue;
-						}
-
-						frontier.push({ neighbour, x != 0 && y != 0 ? current.distance + PlanarDiagonalDistance<extent_t::product_t> : current.distance + PlanarDistance<extent_t::product_t> });
-						insert(neighbour);
-					}
-				}
-			}
+			creep(zone, position, value, distance, inclusive);
 
 			return *this;
 		}
@@ -212,43 +105,7 @@ namespace bleak {
 				clear();
 			}
 
-			if (!zone.dependent within<region_e::All>(position) || zone[position] != value) {
-				return *this;
-			}
-
-			std::queue<creeper_t<f32>> frontier{};
-
-			frontier.push({ position, 0.0f });
-			insert(position);
-
-			while (!frontier.empty()) {
-				const creeper_t current{ frontier.front() };
-				frontier.pop();
-
-				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
-					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
-						if (x == 0 && y == 0) {
-							continue;
-						}
-
-						const offset_t neighbour{ current.position.x + x, current.position.y + y };
-
-						if (!zone.dependent within<region_e::All>(neighbour) || contains(neighbour) || current.distance > distance) {
-							continue;
-						}
-
-						if (inclusive && zone[neighbour] != value) {
-							insert(neighbour);
-							continue;
-						} else if (zone[neighbour] != value) {
-							continue;
-						}
-
-						frontier.push({ neighbour, x != 0 && y != 0 ? current.distance + PlanarDiagonalDistance<extent_t::product_t> : current.distance + PlanarDistance<extent_t::product_t> });
-						insert(neighbour);
-					}
-				}
-			}
+			creep(zone, position, value, distance, inclusive);
 
 			return *this;
 		}
@@ -286,9 +143,7 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius);
-			}
+			shadowcaster_t::local().cast<Size>(position, static_cast<f64>(radius), [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) { insert(cell); });
 
 			return *this;
 		}
@@ -328,9 +183,7 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius);
-			}
+			shadowcaster_t::local().cast<Size>(position, static_cast<f64>(radius), [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) { insert(cell); });
 
 			return *this;
 		}
@@ -368,9 +221,7 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				shadow_cast(zone, circle.position, value, 1, 1.0, 0.0, octant, circle.radius);
-			}
+			shadowcaster_t::local().cast<Size>(circle.position, circle.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) { insert(cell); });
 
 			return *this;
 		}
@@ -410,9 +261,7 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				shadow_cast(zone, circle.position, value, 1, 1.0, 0.0, octant, circle.radius);
-			}
+			shadowcaster_t::local().cast<Size>(circle.position, circle.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) { insert(cell); });
 
 			return *this;
 		}
@@ -431,13 +280,7 @@ namespace bleak {
 				return *this;
 			}
 
-			bool is_nan = std::isnan(angle) || std::isnan(span);
-
-			if (!is_nan) {
-				angle -= 90.0;
-				angle = (angle > 360.0 || angle < 0.0 ? wrap(angle, 360.0) : angle) * PercentOfCircle;
-				span *= PercentOfCircle;
-			}
+			const sector_t sector{ angle, span };
 
 			if (inclusive) {
 				for (offset_t::scalar_t offs_y{ -1 }; offs_y <= 1; ++offs_y) {
@@ -458,9 +301,11 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				is_nan ? shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius) : shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius, angle, span);
-			}
+			shadowcaster_t::local().cast<Size>(position, static_cast<f64>(radius), [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (sector.contains(cell - position)) {
+					insert(cell);
+				}
+			});
 
 			return *this;
 		}
@@ -481,13 +326,7 @@ namespace bleak {
 				return *this;
 			}
 
-			bool is_nan = std::isnan(angle) || std::isnan(span);
-
-			if (!is_nan) {
-				angle -= 90.0;
-				angle = (angle > 360.0 || angle < 0.0 ? wrap(angle, 360.0) : angle) * PercentOfCircle;
-				span *= PercentOfCircle;
-			}
+			const sector_t sector{ angle, span };
 
 			if (inclusive) {
 				for (offset_t::scalar_t offs_y{ -1 }; offs_y <= 1; ++offs_y) {
@@ -508,9 +347,11 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				is_nan ? shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius) : shadow_cast(zone, position, value, 1, 1.0, 0.0, octant, radius, angle, span);
-			}
+			shadowcaster_t::local().cast<Size>(position, static_cast<f64>(radius), [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (sector.contains(cell - position)) {
+					insert(cell);
+				}
+			});
 
 			return *this;
 		}
@@ -529,16 +370,7 @@ namespace bleak {
 				return *this;
 			}
 
-			bool is_nan = std::isnan(arc.angle) || std::isnan(arc.span);
-
-			f64 angle{ arc.angle };
-			f64 span{ arc.span };
-
-			if (!is_nan) {
-				angle -= 90.0;
-				angle = (angle > 360.0 || angle < 0.0 ? wrap(angle, 360.0) : angle) * PercentOfCircle;
-				span *= PercentOfCircle;
-			}
+			const sector_t sector{ arc.angle, arc.span };
 
 			if (inclusive) {
 				for (offset_t::scalar_t offs_y{ -1 }; offs_y <= 1; ++offs_y) {
@@ -559,9 +391,11 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				is_nan ? shadow_cast(zone, arc.position, value, 1, 1.0, 0.0, octant, arc.radius) : shadow_cast(zone, arc.position, value, 1, 1.0, 0.0, octant, arc.radius, angle, span);
-			}
+			shadowcaster_t::local().cast<Size>(arc.position, arc.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (sector.contains(cell - arc.position)) {
+					insert(cell);
+				}
+			});
 
 			return *this;
 		}
@@ -582,16 +416,7 @@ namespace bleak {
 				return *this;
 			}
 
-			bool is_nan = std::isnan(arc.angle) || std::isnan(arc.span);
-
-			f64 angle{ arc.angle };
-			f64 span{ arc.span };
-
-			if (!is_nan) {
-				angle -= 90.0;
-				angle = (angle > 360.0 || angle < 0.0 ? wrap(angle, 360.0) : angle) * PercentOfCircle;
-				span *= PercentOfCircle;
-			}
+			const sector_t sector{ arc.angle, arc.span };
 
 			if (inclusive) {
 				for (offset_t::scalar_t offs_y{ -1 }; offs_y <= 1; ++offs_y) {
@@ -612,9 +437,11 @@ namespace bleak {
 				return *this;
 			}
 
-			for (cref<octant_t> octant : Octants) {
-				is_nan ? shadow_cast(zone, arc.position, value, 1, 1.0, 0.0, octant, arc.radius) : shadow_cast(zone, arc.position, value, 1, 1.0, 0.0, octant, arc.radius, angle, span);
-			}
+			shadowcaster_t::local().cast<Size>(arc.position, arc.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (sector.contains(cell - arc.position)) {
+					insert(cell);
+				}
+			});
 
 			return *this;
 		}
@@ -792,18 +619,17 @@ namespace bleak {
 		}
 
 		template<typename T, extent_t Size, extent_t BorderSize> static std::vector<area_t> partition(cref<zone_t<T, Size, BorderSize>> zone, cref<T> value) {
-			std::vector<area_t> partitions{};
+			component_map_t<Size> components{};
 
-			area_t values{};
-			values.collect(zone, value);
+			components.label(zone, value);
 
-			while (!values.empty()) {
-				area_t partition{};
+			std::vector<area_t> partitions(components.count());
 
-				partition.flood(zone, *values.begin(), value);
-				values.remove(partition);
+			for (usize i{ 0 }; i < components.count(); ++i) {
+				cauto cells{ components.cells_of(i) };
 
-				partitions.push_back(std::move(partition));
+				partitions[i].reserve(cells.size());
+				partitions[i].insert(cells.begin(), cells.end());
 			}
 
 			return partitions;
@@ -812,241 +638,161 @@ namespace bleak {
 		template<typename T, typename U, extent_t Size, extent_t BorderSize>
 			requires is_equatable<T, U>::value
 		static std::vector<area_t> partition(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) {
-			std::vector<area_t> partitions{};
+			component_map_t<Size> components{};
 
-			area_t values{};
-			values.collect(zone, value);
+			components.label(zone, value);
 
-			while (!values.empty()) {
-				area_t partition{};
+			std::vector<area_t> partitions(components.count());
 
-				partition.flood(zone, *values.begin(), value);
-				values.remove(partition);
+			for (usize i{ 0 }; i < components.count(); ++i) {
+				cauto cells{ components.cells_of(i) };
 
-				partitions.push_back(std::move(partition));
+				partitions[i].reserve(cells.size());
+				partitions[i].insert(cells.begin(), cells.end());
 			}
 
 			return partitions;
 		}
 
 	  private:
-		template<typename T, extent_t Size, extent_t BorderSize> inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<T> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
-			if (start < end) {
-				return;
-			}
-
-			f64 new_start{ 0.0 };
-
-			bool blocked{ false };
-
-			for (f64 distance{ static_cast<f64>(row) }; distance <= radius && distance < zone.zone_area && !blocked; ++distance) {
-				f64 dy = -distance;
-
-				for (f64 dx = -distance; dx <= 0.0; ++dx) {
-					const offset_t delta{ dx, dy };
-
-					const offset_t position{ origin.x + delta.x * octant.position.x + delta.y * octant.delta.x, origin.y + delta.x * octant.position.y + delta.y * octant.delta.y };
-
-					f64 left_slope{ (dx - 0.5) / (dy + 0.5) };
-					f64 right_slope{ (dx + 0.5) / (dy - 0.5) };
-
-					if (!zone.dependent within<region_e::All>(position) || start < right_slope) {
-						continue;
-					}
-
-					if (end > left_slope) {
-						break;
-					}
-
-					const f64 delta_radius{ std::sqrt(dx * dx + dy * dy) };
-
-					if (delta_radius <= radius) {
-						insert(position);
-					}
-
-					if (blocked) {
-						if (zone[position] != value) {
-							new_start = right_slope;
-						} else {
-							blocked = false;
-							start = new_start;
-						}
-					} else if (zone[position] != value && distance < radius) {
-						blocked = true;
-
-						shadow_cast(zone, origin, value, static_cast<i32>(distance) + 1, start, left_slope, octant, radius);
-
-						new_start = right_slope;
-					}
-				}
-			}
-		}
+		template<extent_t Size> static constexpr bool inside(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
 
+		// widens each seed into the full run of matching cells on its row, then seeds only the first cell of each unvisited run touching it above and below
 		template<typename T, typename U, extent_t Size, extent_t BorderSize>
 			requires is_equatable<T, U>::value
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius) {
-			if (start < end) {
+		inline void scan_fill(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<U> value, bool inclusive) {
+			if (!inside<Size>(position) || zone[position] != value) {
 				return;
 			}
 
-			f64 new_start{ 0.0 };
+			bitboard_t<Size> visited{};
 
-			bool blocked{ false };
+			std::vector<offset_t> seeds{};
 
-			for (f64 distance{ static_cast<f64>(row) }; distance <= radius && distance < zone.zone_area && !blocked; ++distance) {
-				f64 dy = -distance;
+			seeds.push_back(position);
 
-				for (f64 dx = -distance; dx <= 0.0; ++dx) {
-					const offset_t delta{ dx, dy };
+			while (!seeds.empty()) {
+				const offset_t seed{ seeds.back() };
+				seeds.pop_back();
 
-					const offset_t position{ origin.x + delta.x * octant.position.x + delta.y * octant.delta.x, origin.y + delta.x * octant.position.y + delta.y * octant.delta.y };
+				if (visited.test(seed)) {
+					continue;
+				}
 
-					f64 left_slope{ (dx - 0.5) / (dy + 0.5) };
-					f64 right_slope{ (dx + 0.5) / (dy - 0.5) };
+				const offset_t::scalar_t y{ seed.y };
 
-					if (!zone.dependent within<region_e::All>(position) || start < right_slope) {
-						continue;
-					}
+				offset_t::scalar_t left{ seed.x };
+				offset_t::scalar_t right{ seed.x };
 
-					if (end > left_slope) {
-						break;
-					}
+				while (left > 0 && zone[offset_t{ left - 1, y }] == value) {
+					--left;
+				}
 
-					const f64 delta_radius{ std::sqrt(dx * dx + dy * dy) };
+				while (right + 1 < Size.w && zone[offset_t{ right + 1, y }] == value) {
+					++right;
+				}
 
-					if (delta_radius <= radius) {
-						insert(position);
-					}
+				for (offset_t::scalar_t x{ left }; x <= right; ++x) {
+					visited.set(offset_t{ x, y });
+					insert(offset_t{ x, y });
+				}
 
-					if (blocked) {
-						if (zone[position] != value) {
-							new_start = right_slope;
-						} else {
-							blocked = false;
-							start = new_start;
-						}
-					} else if (zone[position] != value && distance < radius) {
-						blocked = true;
+				// eight-way connectivity reaches one cell past either end of the run
+				const offset_t::scalar_t low{ std::max<offset_t::scalar_t>(left - 1, 0) };
+				const offset_t::scalar_t high{ std::min<offset_t::scalar_t>(right + 1, Size.w - 1) };
 
-						shadow_cast(zone, origin, value, static_cast<i32>(distance) + 1, start, left_slope, octant, radius);
+				if (inclusive) {
+					if (left > 0) {
+						insert(offset_t{ left - 1, y });
+					}
 
-						new_start = right_slope;
+					if (right + 1 < Size.w) {
+						insert(offset_t{ right + 1, y });
 					}
 				}
-			}
-
-			return;
-		}
-
-		template<typename T, extent_t Size, extent_t BorderSize>
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<T> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
-			if (start < end) {
-				return;
-			}
 
-			f64 new_start{ 0.0 };
-
-			bool blocked{ false };
-
-			for (f64 distance{ static_cast<f64>(row) }; distance <= radius && distance < zone.zone_area && !blocked; ++distance) {
-				f64 dy = -distance;
-
-				for (f64 dx = -distance; dx <= 0.0; ++dx) {
-					const offset_t position{ origin.x + dx * octant.position.x + dy * octant.delta.x, origin.y + dx * octant.position.y + dy * octant.delta.y };
-					const offset_t delta{ position - origin };
-
-					f64 left_slope{ (dx - 0.5) / (dy + 0.5) };
-					f64 right_slope{ (dx + 0.5) / (dy - 0.5) };
-
-					if (!zone.dependent within<region_e::All>(position) || start < right_slope) {
+				for (const offset_t::scalar_t row : { y - 1, y + 1 }) {
+					if (row < 0 || row >= Size.h) {
 						continue;
 					}
 
-					if (end > left_slope) {
-						break;
-					}
+					bool running{ false };
 
-					const f64 delta_radius{ std::sqrt(dx * dx + dy * dy) };
-					const f64 result{ std::abs(angle - atan2<f64>(delta.y, delta.x)) };
+					for (offset_t::scalar_t x{ low }; x <= high; ++x) {
+						const offset_t cell{ x, row };
 
-					if (delta_radius <= radius && (result <= span * 0.5 || result >= 1.0 - span * 0.5)) {
-						insert(position);
-					}
+						if (zone[cell] != value) {
+							running = false;
 
-					if (blocked) {
-						if (zone[position] != value) {
-							new_start = right_slope;
-						} else {
-							blocked = false;
-							start = new_start;
+							if (inclusive) {
+								insert(cell);
+							}
+
+							continue;
 						}
-					} else if (zone[position] != value && distance < radius) {
-						blocked = true;
 
-						shadow_cast(zone, origin, value, static_cast<i32>(distance) + 1, start, left_slope, octant, radius, angle, span);
+						if (!running && !visited.test(cell)) {
+							seeds.push_back(cell);
+						}
 
-						new_start = right_slope;
+						running = true;
 					}
 				}
 			}
-
-			return;
 		}
 
+		// breadth-first so that the accumulated step distance bounds the flood, with a dense mask in place of hash probes for visited cells
 		template<typename T, typename U, extent_t Size, extent_t BorderSize>
 			requires is_equatable<T, U>::value
-		inline void shadow_cast(cref<zone_t<T, Size, BorderSize>> zone, offset_t origin, cref<U> value, i32 row, f64 start, f64 end, cref<octant_t> octant, f64 radius, f64 angle, f64 span) {
-			if (start < end) {
+		inline void creep(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<U> value, cref<extent_t::product_t> distance, bool inclusive) {
+			if (!inside<Size>(position) || zone[position] != value) {
 				return;
 			}
 
-			f64 new_start{ 0.0 };
+			bitboard_t<Size> visited{};
 
-			bool blocked{ false };
+			std::queue<creeper_t<f32>> frontier{};
 
-			for (f64 distance{ static_cast<f64>(row) }; distance <= radius && distance < zone.zone_area && !blocked; ++distance) {
-				f64 dy = -distance;
+			frontier.push({ position, 0.0f });
+			visited.set(position);
+			insert(position);
 
-				for (f64 dx = -distance; dx <= 0.0; ++dx) {
-					const offset_t position{ origin.x + dx * octant.position.x + dy * octant.delta.x, origin.y + dx * octant.position.y + dy * octant.delta.y };
-					const offset_t delta{ position - origin };
+			while (!frontier.empty()) {
+				const creeper_t current{ frontier.front() };
+				frontier.pop();
 
-					f64 left_slope{ (dx - 0.5) / (dy + 0.5) };
-					f64 right_slope{ (dx + 0.5) / (dy - 0.5) };
+				if (current.distance > distance) {
+					continue;
+				}
 
-					if (!zone.dependent within<region_e::All>(position) || start < right_slope) {
-						continue;
-					}
+				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
+					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
+						if (x == 0 && y == 0) {
+							continue;
+						}
 
-					if (end > left_slope) {
-						break;
-					}
+						const offset_t neighbour{ current.position.x + x, current.position.y + y };
 
-					const f64 delta_radius{ std::sqrt(dx * dx + dy * dy) };
-					const f64 result{ std::abs(angle - atan2<f64>(delta.y, delta.x)) };
+						if (!inside<Size>(neighbour) || visited.test(neighbour)) {
+							continue;
+						}
 
-					if (delta_radius <= radius && (result <= span * 0.5 || result >= 1.0 - span * 0.5)) {
-						insert(position);
-					}
+						if (zone[neighbour] != value) {
+							if (inclusive) {
+								visited.set(neighbour);
+								insert(neighbour);
+							}
 
-					if (blocked) {
-						if (zone[position] != value) {
-							new_start = right_slope;
-						} else {
-							blocked = false;
-							start = new_start;
+							continue;
 						}
-					} else if (zone[position] != value && distance < radius) {
-						blocked = true;
 
-						shadow_cast(zone, origin, value, static_cast<i32>(distance) + 1, start, left_slope, octant, radius, angle, span);
+						visited.set(neighbour);
+						insert(neighbour);
 
-						new_start = right_slope;
+						frontier.push({ neighbour, x != 0 && y != 0 ? current.distance + PlanarDiagonalDistance<extent_t::product_t> : current.distance + PlanarDistance<extent_t::product_t> });
 					}
 				}
 			}
-
-			return;
 		}
 	};
 } // namespace bleak
@@ -182,6 +182,8 @@ namespace bleak {
 			return data[first + flatten(i, j)];
 		}
 
+		inline constexpr void reset() noexcept { data.reset(); }
+
 		constexpr bool operator==(cref<binarray_t> other) const noexcept {
 			return data == other.data;
 		}
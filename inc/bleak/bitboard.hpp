@@ -0,0 +1,207 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+#include <bleak/array.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct bitboard_t {
+		using word_t = u64;
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize word_bits{ sizeof(word_t) * 8 };
+
+		static constexpr usize row_words{ (static_cast<usize>(Size.w) + word_bits - 1) / word_bits };
+		static constexpr usize word_count{ row_words * static_cast<usize>(Size.h) };
+
+		static constexpr usize tail_bits{ static_cast<usize>(Size.w) % word_bits };
+
+		// bits of the last word in each row that lie within the zone
+		static constexpr word_t tail_mask{ tail_bits == 0 ? ~word_t{ 0 } : (word_t{ 1 } << tail_bits) - 1 };
+
+		static_assert(Size.w > 0 && Size.h > 0, "bitboard size must be greater than zero!");
+
+	  private:
+		std::vector<word_t> words;
+
+		// stands in for the rows beyond the top and bottom edges, where every neighbour counts as set
+		static constexpr std::array<word_t, row_words> solid_row{ [] {
+			std::array<word_t, row_words> row{};
+
+			row.fill(~word_t{ 0 });
+
+			return row;
+		}() };
+
+		static constexpr word_t west_of(cptr<word_t> row, usize k) noexcept { return (row[k] << 1) | (k > 0 ? row[k - 1] >> (word_bits - 1) : word_t{ 1 }); }
+
+		static constexpr word_t east_of(cptr<word_t> row, usize k) noexcept { return (row[k] >> 1) | ((k + 1 < row_words ? row[k + 1] : ~word_t{ 0 }) << (word_bits - 1)); }
+
+	  public:
+		constexpr bitboard_t() : words(word_count, word_t{ 0 }) {}
+
+		constexpr bitboard_t(cref<bitboard_t> other) : words{ other.words } {}
+
+		constexpr bitboard_t(rval<bitboard_t> other) noexcept : words{ std::move(other.words) } {}
+
+		constexpr ref<bitboard_t> operator=(cref<bitboard_t> other) {
+			if (this != &other) {
+				words = other.words;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<bitboard_t> operator=(rval<bitboard_t> other) noexcept {
+			if (this != &other) {
+				words = std::move(other.words);
+			}
+
+			return *this;
+		}
+
+		constexpr ~bitboard_t() noexcept {}
+
+		constexpr ref<word_t> operator[](usize index) noexcept { return words[index]; }
+
+		constexpr word_t operator[](usize index) const noexcept { return words[index]; }
+
+		constexpr ptr<word_t> row(extent_t::scalar_t y) noexcept { return words.data() + static_cast<usize>(y) * row_words; }
+
+		constexpr cptr<word_t> row(extent_t::scalar_t y) const noexcept { return words.data() + static_cast<usize>(y) * row_words; }
+
+		constexpr bool test(offset_t position) const noexcept { return (row(position.y)[position.x / word_bits] >> (position.x % word_bits)) & word_t{ 1 }; }
+
+		constexpr void set(offset_t position) noexcept { row(position.y)[position.x / word_bits] |= word_t{ 1 } << (position.x % word_bits); }
+
+		constexpr void reset(offset_t position) noexcept { row(position.y)[position.x / word_bits] &= ~(word_t{ 1 } << (position.x % word_bits)); }
+
+		// sets the bits of a row in [begin, end), a word at a time
+		constexpr void set(extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) noexcept {
+			const ptr<word_t> bits{ row(y) };
+
+			for (usize k{ static_cast<usize>(begin) / word_bits }; k * word_bits < static_cast<usize>(end); ++k) {
+				const usize low{ std::max<usize>(static_cast<usize>(begin), k * word_bits) - k * word_bits };
+				const usize high{ std::min<usize>(static_cast<usize>(end), (k + 1) * word_bits) - k * word_bits };
+
+				const word_t upper{ high == word_bits ? ~word_t{ 0 } : (word_t{ 1 } << high) - 1 };
+
+				bits[k] |= upper & ~((word_t{ 1 } << low) - 1);
+			}
+		}
+
+		constexpr void clear() noexcept { std::fill(words.begin(), words.end(), word_t{ 0 }); }
+
+		constexpr void swap(ref<bitboard_t> other) noexcept { std::swap(words, other.words); }
+
+		// sets each bit whose cell compares equal to value; bits past the zone's width are set so out-of-bounds neighbours count as matches
+		template<typename T, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<bitboard_t> pack(cref<array_t<T, Size>> cells, cref<U> value) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				ptr<word_t> dst{ row(y) };
+
+				for (usize k{ 0 }; k < row_words; ++k) {
+					const usize x_origin{ k * word_bits };
+					const usize x_count{ k + 1 < row_words || tail_bits == 0 ? word_bits : tail_bits };
+
+					word_t word{ k + 1 < row_words ? word_t{ 0 } : ~tail_mask };
+
+					for (usize i{ 0 }; i < x_count; ++i) {
+						word |= static_cast<word_t>(cells[static_cast<extent_t::scalar_t>(x_origin + i), y] == value) << i;
+					}
+
+					dst[k] = word;
+				}
+			}
+
+			return *this;
+		}
+
+		// writes true_value or false_value into each cell whose bit is set in mask
+		template<typename T, typename U>
+			requires std::is_assignable<ref<T>, U>::value
+		constexpr cref<bitboard_t> unpack(ref<array_t<T, Size>> cells, cref<bitboard_t> mask, cref<U> true_value, cref<U> false_value) const noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				cptr<word_t> src{ row(y) };
+				cptr<word_t> msk{ mask.row(y) };
+
+				for (usize k{ 0 }; k < row_words; ++k) {
+					word_t pending{ msk[k] & (k + 1 < row_words ? ~word_t{ 0 } : tail_mask) };
+
+					while (pending != 0) {
+						const usize i{ static_cast<usize>(std::countr_zero(pending)) };
+						pending &= pending - 1;
+
+						cells[static_cast<extent_t::scalar_t>(k * word_bits + i), y] = (src[k] >> i) & word_t{ 1 } ? true_value : false_value;
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		// bit-sliced moore neighbourhood count of source compared against threshold; out-of-bounds neighbours count as set
+		static constexpr void compare(cref<bitboard_t> source, u8 threshold, ref<bitboard_t> above, ref<bitboard_t> below) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				cptr<word_t> north{ y > 0 ? source.row(y - 1) : solid_row.data() };
+				cptr<word_t> central{ source.row(y) };
+				cptr<word_t> south{ y + 1 < Size.h ? source.row(y + 1) : solid_row.data() };
+
+				ptr<word_t> greater{ above.row(y) };
+				ptr<word_t> lesser{ below.row(y) };
+
+				for (usize k{ 0 }; k < row_words; ++k) {
+					const word_t nw{ west_of(north, k) }, n{ north[k] }, ne{ east_of(north, k) };
+					const word_t w{ west_of(central, k) }, e{ east_of(central, k) };
+					const word_t sw{ west_of(south, k) }, s{ south[k] }, se{ east_of(south, k) };
+
+					const word_t a_sum{ nw ^ n ^ ne }, a_carry{ (nw & n) | (ne & (nw ^ n)) };
+					const word_t b_sum{ w ^ e ^ sw }, b_carry{ (w & e) | (sw & (w ^ e)) };
+					const word_t c_sum{ s ^ se }, c_carry{ s & se };
+
+					const word_t ones_bit{ a_sum ^ b_sum ^ c_sum }, ones_carry{ (a_sum & b_sum) | (c_sum & (a_sum ^ b_sum)) };
+
+					const word_t t_sum{ a_carry ^ b_carry ^ c_carry }, t_carry{ (a_carry & b_carry) | (c_carry & (a_carry ^ b_carry)) };
+
+					const word_t twos_bit{ t_sum ^ ones_carry }, twos_carry{ t_sum & ones_carry };
+
+					const word_t fours_bit{ t_carry ^ twos_carry }, eights_bit{ t_carry & twos_carry };
+
+					if (threshold > 0x0F) {
+						greater[k] = word_t{ 0 };
+						lesser[k] = ~word_t{ 0 };
+
+						continue;
+					}
+
+					const word_t planes[4]{ ones_bit, twos_bit, fours_bit, eights_bit };
+
+					word_t gt{ 0 };
+					word_t eq{ ~word_t{ 0 } };
+
+					for (usize b{ 4 }; b-- > 0;) {
+						if ((threshold >> b) & 1) {
+							eq &= planes[b];
+						} else {
+							gt |= eq & planes[b];
+							eq &= ~planes[b];
+						}
+					}
+
+					greater[k] = gt;
+					lesser[k] = ~(gt | eq);
+				}
+			}
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/creeper.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	template<typename D> struct bucket_queue_t {
+		static_assert(is_integer<D>::value, "bucket queue distances must be integral!");
+
+	  private:
+		std::vector<std::vector<offset_t>> buckets;
+		std::vector<creeper_t<D>> seeds;
+
+		usize next_seed;
+		usize count;
+		isize cursor;
+
+		bool unsorted;
+
+		constexpr usize index(isize distance) const noexcept {
+			const isize span{ static_cast<isize>(buckets.size()) };
+
+			return static_cast<usize>(((distance % span) + span) % span);
+		}
+
+		constexpr void grow(usize required) noexcept {
+			const usize previous{ buckets.size() };
+
+			usize span{ previous };
+
+			while (span < required) {
+				span *= 2;
+			}
+
+			std::vector<std::vector<offset_t>> resized(span);
+
+			const usize origin{ index(cursor) };
+
+			for (usize i{ 0 }; i < previous; ++i) {
+				const isize distance{ cursor + static_cast<isize>((i + previous - origin) % previous) };
+
+				ref<std::vector<offset_t>> bucket{ resized[static_cast<usize>(distance % static_cast<isize>(span) + static_cast<isize>(span)) % span] };
+
+				bucket.insert(bucket.end(), buckets[i].begin(), buckets[i].end());
+			}
+
+			buckets.swap(resized);
+		}
+
+	  public:
+		constexpr bucket_queue_t() : bucket_queue_t{ 2 } {}
+
+		constexpr explicit bucket_queue_t(usize span) : buckets(std::max<usize>(span, 1)), seeds{}, next_seed{ 0 }, count{ 0 }, cursor{ 0 }, unsorted{ false } {}
+
+		constexpr usize span() const noexcept { return buckets.size(); }
+
+		constexpr usize size() const noexcept { return count + seeds.size() - next_seed; }
+
+		constexpr bool empty() const noexcept { return count == 0 && next_seed >= seeds.size(); }
+
+		constexpr void clear() noexcept {
+			for (ref<std::vector<offset_t>> bucket : buckets) {
+				bucket.clear();
+			}
+
+			seeds.clear();
+
+			next_seed = 0;
+			count = 0;
+			cursor = 0;
+
+			unsorted = false;
+		}
+
+		// seeds may carry any distance; they are merged into the buckets in order as the cursor reaches them
+		constexpr void seed(offset_t position, D distance) noexcept {
+			seeds.emplace_back(position, distance);
+
+			unsorted = true;
+		}
+
+		// pushed distances must not precede the cursor; the span doubles whenever a push lands beyond it
+		constexpr void push(offset_t position, D distance) noexcept {
+			const isize delta{ static_cast<isize>(distance) - cursor };
+
+			if (delta >= static_cast<isize>(buckets.size())) {
+				grow(static_cast<usize>(delta) + 1);
+			}
+
+			buckets[index(static_cast<isize>(distance))].push_back(position);
+
+			++count;
+		}
+
+		constexpr creeper_t<D> pop() noexcept {
+			if (unsorted) {
+				std::sort(seeds.begin() + next_seed, seeds.end(), [](cref<creeper_t<D>> lhs, cref<creeper_t<D>> rhs) { return lhs.distance < rhs.distance; });
+
+				unsorted = false;
+			}
+
+			if (count == 0) {
+				cursor = static_cast<isize>(seeds[next_seed].distance);
+			}
+
+			const isize horizon{ cursor + static_cast<isize>(buckets.size()) };
+
+			while (next_seed < seeds.size() && static_cast<isize>(seeds[next_seed].distance) < horizon) {
+				push(seeds[next_seed].position, seeds[next_seed].distance);
+
+				++next_seed;
+			}
+
+			while (buckets[index(cursor)].empty()) {
+				++cursor;
+			}
+
+			ref<std::vector<offset_t>> bucket{ buckets[index(cursor)] };
+
+			const offset_t position{ bucket.back() };
+			bucket.pop_back();
+
+			--count;
+
+			return creeper_t<D>{ position, static_cast<D>(cursor) };
+		}
+	};
+} // namespace bleak
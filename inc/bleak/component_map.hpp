@@ -0,0 +1,206 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// eight-way connected components of the cells equal to a value, labelled in two row-major sweeps
+	template<extent_t Size> struct component_map_t {
+		using label_t = u32;
+
+		struct component_t {
+			label_t label;
+
+			usize size;
+
+			rect_t bounds;
+		};
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr label_t no_label{ 0 };
+
+	  private:
+		std::vector<label_t> labels;
+
+		// provisional labels from the first sweep, each pointing at a lower label in the same component
+		std::vector<label_t> parents;
+
+		std::vector<component_t> entries;
+
+		std::vector<offset_t> cells;
+		std::vector<usize> offsets;
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		constexpr label_t find(label_t label) noexcept {
+			while (parents[label] != label) {
+				parents[label] = parents[parents[label]];
+				label = parents[label];
+			}
+
+			return label;
+		}
+
+		// the higher root always joins the lower so that every parent precedes its children
+		constexpr label_t unite(label_t lhs, label_t rhs) noexcept {
+			lhs = find(lhs);
+			rhs = find(rhs);
+
+			if (lhs < rhs) {
+				parents[rhs] = lhs;
+
+				return lhs;
+			}
+
+			parents[lhs] = rhs;
+
+			return rhs;
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		constexpr void sweep(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			parents.clear();
+			parents.push_back(no_label);
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				ptr<label_t> row{ labels.data() + static_cast<usize>(y) * static_cast<usize>(Size.w) };
+				cptr<label_t> above{ y > 0 ? row - Size.w : nullptr };
+
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					if (zone[offset_t{ x, y }] != value) {
+						row[x] = no_label;
+
+						continue;
+					}
+
+					// only the west and the three northern neighbours have been labelled so far
+					label_t label{ x > 0 ? row[x - 1] : no_label };
+
+					if (above != nullptr) {
+						for (extent_t::scalar_t dx{ -1 }; dx <= 1; ++dx) {
+							const extent_t::scalar_t nx{ static_cast<extent_t::scalar_t>(x + dx) };
+
+							if (nx < 0 || nx >= Size.w || above[nx] == no_label) {
+								continue;
+							}
+
+							label = label == no_label ? above[nx] : unite(label, above[nx]);
+						}
+					}
+
+					if (label == no_label) {
+						label = static_cast<label_t>(parents.size());
+						parents.push_back(label);
+					}
+
+					row[x] = label;
+				}
+			}
+		}
+
+		constexpr void resolve() noexcept {
+			entries.clear();
+
+			// roots become consecutive final labels; every other label takes its already resolved parent's
+			for (label_t label{ 1 }; label < parents.size(); ++label) {
+				if (parents[label] == label) {
+					parents[label] = static_cast<label_t>(entries.size() + 1);
+					entries.push_back(component_t{ parents[label], 0, rect_t{} });
+				} else {
+					parents[label] = parents[parents[label]];
+				}
+			}
+
+			std::vector<offset_t> minimums(entries.size(), offset_t{ Size.w, Size.h });
+			std::vector<offset_t> maximums(entries.size(), offset_t{ -1, -1 });
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				ptr<label_t> row{ labels.data() + static_cast<usize>(y) * static_cast<usize>(Size.w) };
+
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					if (row[x] == no_label) {
+						continue;
+					}
+
+					row[x] = parents[row[x]];
+
+					const usize index{ row[x] - 1 };
+
+					++entries[index].size;
+
+					minimums[index] = offset_t{ std::min(minimums[index].x, x), std::min(minimums[index].y, y) };
+					maximums[index] = offset_t{ std::max(maximums[index].x, x), std::max(maximums[index].y, y) };
+				}
+			}
+
+			offsets.resize(entries.size() + 1);
+			offsets[0] = 0;
+
+			for (usize i{ 0 }; i < entries.size(); ++i) {
+				offsets[i + 1] = offsets[i] + entries[i].size;
+
+				entries[i].bounds = rect_t{ minimums[i], extent_t{ maximums[i].x - minimums[i].x + 1, maximums[i].y - minimums[i].y + 1 } };
+			}
+
+			cells.resize(offsets.back());
+
+			std::vector<usize> cursors(offsets.begin(), offsets.end() - 1);
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				cptr<label_t> row{ labels.data() + static_cast<usize>(y) * static_cast<usize>(Size.w) };
+
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					if (row[x] != no_label) {
+						cells[cursors[row[x] - 1]++] = offset_t{ x, y };
+					}
+				}
+			}
+		}
+
+	  public:
+		inline component_map_t() noexcept : labels(area, no_label), parents{}, entries{}, cells{}, offsets{ 0 } {}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<component_map_t> label(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			sweep(zone, value);
+			resolve();
+
+			return *this;
+		}
+
+		inline usize count() const noexcept { return entries.size(); }
+
+		inline bool empty() const noexcept { return entries.empty(); }
+
+		// the label of the component holding a cell, or no_label if it does not match
+		inline label_t at(offset_t position) const noexcept { return contains(position) ? labels[flatten(position)] : no_label; }
+
+		inline label_t operator[](offset_t position) const noexcept { return labels[flatten(position)]; }
+
+		inline std::span<const label_t> data() const noexcept { return std::span<const label_t>{ labels.data(), labels.size() }; }
+
+		// components are ordered by their first cell in row-major order, with component i carrying label i + 1
+		inline cref<component_t> component(usize index) const noexcept { return entries[index]; }
+
+		inline std::span<const component_t> components() const noexcept { return std::span<const component_t>{ entries.data(), entries.size() }; }
+
+		// the cells of a component in row-major order
+		inline std::span<const offset_t> cells_of(usize index) const noexcept { return std::span<const offset_t>{ cells.data() + offsets[index], offsets[index + 1] - offsets[index] }; }
+	};
+} // namespace bleak
@@ -18,6 +18,30 @@ namespace bleak {
 		Melded
 	};
 
+	enum struct automaton_e : u8 {
+		Scalar,
+		Packed,
+		Parallel
+	};
+
+	enum struct search_e : u8 {
+		AStar,
+		JumpPoint
+	};
+
+	enum struct search_status_e : u8 {
+		Idle,
+		Searching,
+		Found,
+		Exhausted
+	};
+
+	enum struct falloff_e : u8 {
+		Constant,
+		Linear,
+		Quadratic
+	};
+
 	enum struct wave_e {
 		Sine,
 		Square,
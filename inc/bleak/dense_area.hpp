@@ -0,0 +1,479 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <bleak/applicator.hpp>
+#include <bleak/arc.hpp>
+#include <bleak/area.hpp>
+#include <bleak/circle.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/shadowcaster.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// a set of cells within a fixed extent stored as one bit per cell in the same row-major order as zone_t
+	template<extent_t Size> struct dense_area_t {
+		using word_t = u64;
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr usize word_bits{ sizeof(word_t) * 8 };
+		static constexpr usize word_count{ (area + word_bits - 1) / word_bits };
+
+		static_assert(Size.w > 0 && Size.h > 0, "dense area size must be greater than zero!");
+
+		struct iterator {
+		  private:
+			cptr<word_t> words;
+
+			usize index;
+			word_t pending;
+
+			// steps over whole empty words so sparse sets cost one comparison per 64 cells
+			constexpr void skip() noexcept {
+				while (pending == 0 && ++index < word_count) {
+					pending = words[index];
+				}
+
+				if (index >= word_count) {
+					index = word_count;
+					pending = 0;
+				}
+			}
+
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = isize;
+			using value_type = offset_t;
+			using pointer = void;
+			using reference = offset_t;
+
+			constexpr iterator() noexcept : words{ nullptr }, index{ word_count }, pending{ 0 } {}
+
+			constexpr iterator(cptr<word_t> words, usize index) noexcept : words{ words }, index{ index }, pending{ index < word_count ? words[index] : word_t{ 0 } } { skip(); }
+
+			constexpr offset_t operator*() const noexcept { return unflatten(index * word_bits + static_cast<usize>(std::countr_zero(pending))); }
+
+			constexpr ref<iterator> operator++() noexcept {
+				pending &= pending - 1;
+
+				skip();
+
+				return *this;
+			}
+
+			constexpr iterator operator++(int) noexcept {
+				iterator previous{ *this };
+
+				++(*this);
+
+				return previous;
+			}
+
+			constexpr bool operator==(cref<iterator> other) const noexcept { return index == other.index && pending == other.pending; }
+		};
+
+		using const_iterator = iterator;
+
+	  private:
+		std::vector<word_t> words;
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr offset_t unflatten(usize index) noexcept { return offset_t{ static_cast<offset_t::scalar_t>(index % static_cast<usize>(Size.w)), static_cast<offset_t::scalar_t>(index / static_cast<usize>(Size.w)) }; }
+
+		static constexpr bool within(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		constexpr void mark(offset_t position) noexcept {
+			const usize index{ flatten(position) };
+
+			words[index / word_bits] |= word_t{ 1 } << (index % word_bits);
+		}
+
+		constexpr void surround(offset_t position) noexcept {
+			for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
+				for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
+					insert(offset_t{ position.x + x, position.y + y });
+				}
+			}
+		}
+
+		// visits the flat index of every set bit in ascending order
+		template<typename Visitor> constexpr void each(Visitor visitor) const noexcept {
+			for (usize k{ 0 }; k < word_count; ++k) {
+				word_t pending{ words[k] };
+
+				while (pending != 0) {
+					visitor(k * word_bits + static_cast<usize>(std::countr_zero(pending)));
+
+					pending &= pending - 1;
+				}
+			}
+		}
+
+	  public:
+		constexpr dense_area_t() : words(word_count, word_t{ 0 }) {}
+
+		constexpr explicit dense_area_t(cref<area_t> other) : words(word_count, word_t{ 0 }) { add(other); }
+
+		constexpr dense_area_t(cref<dense_area_t> other) : words{ other.words } {}
+
+		constexpr dense_area_t(rval<dense_area_t> other) noexcept : words{ std::move(other.words) } {}
+
+		constexpr ref<dense_area_t> operator=(cref<dense_area_t> other) {
+			if (this != &other) {
+				words = other.words;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dense_area_t> operator=(rval<dense_area_t> other) noexcept {
+			if (this != &other) {
+				words = std::move(other.words);
+			}
+
+			return *this;
+		}
+
+		constexpr ~dense_area_t() noexcept {}
+
+		constexpr iterator begin() const noexcept { return iterator{ words.data(), 0 }; }
+
+		constexpr iterator end() const noexcept { return iterator{ words.data(), word_count }; }
+
+		constexpr cptr<word_t> data() const noexcept { return words.data(); }
+
+		constexpr usize size() const noexcept {
+			usize count{ 0 };
+
+			for (cauto word : words) {
+				count += static_cast<usize>(std::popcount(word));
+			}
+
+			return count;
+		}
+
+		constexpr bool empty() const noexcept {
+			return std::all_of(words.begin(), words.end(), [](word_t word) { return word == 0; });
+		}
+
+		constexpr void clear() noexcept { std::fill(words.begin(), words.end(), word_t{ 0 }); }
+
+		constexpr void swap(ref<dense_area_t> other) noexcept { std::swap(words, other.words); }
+
+		constexpr bool contains(offset_t position) const noexcept {
+			if (!within(position)) {
+				return false;
+			}
+
+			const usize index{ flatten(position) };
+
+			return (words[index / word_bits] >> (index % word_bits)) & word_t{ 1 };
+		}
+
+		// returns whether the cell was newly added; cells outside the extent are ignored
+		constexpr bool insert(offset_t position) noexcept {
+			if (!within(position)) {
+				return false;
+			}
+
+			const usize index{ flatten(position) };
+			const word_t bit{ word_t{ 1 } << (index % word_bits) };
+
+			ref<word_t> word{ words[index / word_bits] };
+
+			if (word & bit) {
+				return false;
+			}
+
+			word |= bit;
+
+			return true;
+		}
+
+		constexpr bool erase(offset_t position) noexcept {
+			if (!within(position)) {
+				return false;
+			}
+
+			const usize index{ flatten(position) };
+			const word_t bit{ word_t{ 1 } << (index % word_bits) };
+
+			ref<word_t> word{ words[index / word_bits] };
+
+			if (!(word & bit)) {
+				return false;
+			}
+
+			word &= ~bit;
+
+			return true;
+		}
+
+		// the word-wise set operations have no cross-iteration dependencies and vectorize at -O2 and above
+		constexpr ref<dense_area_t> operator|=(cref<dense_area_t> other) noexcept {
+			for (usize k{ 0 }; k < word_count; ++k) {
+				words[k] |= other.words[k];
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dense_area_t> operator&=(cref<dense_area_t> other) noexcept {
+			for (usize k{ 0 }; k < word_count; ++k) {
+				words[k] &= other.words[k];
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dense_area_t> operator-=(cref<dense_area_t> other) noexcept {
+			for (usize k{ 0 }; k < word_count; ++k) {
+				words[k] &= ~other.words[k];
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dense_area_t> operator^=(cref<dense_area_t> other) noexcept {
+			for (usize k{ 0 }; k < word_count; ++k) {
+				words[k] ^= other.words[k];
+			}
+
+			return *this;
+		}
+
+		constexpr dense_area_t operator|(cref<dense_area_t> other) const { return dense_area_t{ *this } |= other; }
+
+		constexpr dense_area_t operator&(cref<dense_area_t> other) const { return dense_area_t{ *this } &= other; }
+
+		constexpr dense_area_t operator-(cref<dense_area_t> other) const { return dense_area_t{ *this } -= other; }
+
+		constexpr dense_area_t operator^(cref<dense_area_t> other) const { return dense_area_t{ *this } ^= other; }
+
+		constexpr bool operator==(cref<dense_area_t> other) const noexcept { return words == other.words; }
+
+		constexpr ref<dense_area_t> add(cref<dense_area_t> other) noexcept { return *this |= other; }
+
+		constexpr ref<dense_area_t> remove(cref<dense_area_t> other) noexcept { return *this -= other; }
+
+		constexpr ref<dense_area_t> intersect(cref<dense_area_t> other) noexcept { return *this &= other; }
+
+		constexpr ref<dense_area_t> add(cref<area_t> other) noexcept {
+			for (offset_t position : other) {
+				insert(position);
+			}
+
+			return *this;
+		}
+
+		constexpr ref<dense_area_t> remove(cref<area_t> other) noexcept {
+			for (offset_t position : other) {
+				erase(position);
+			}
+
+			return *this;
+		}
+
+		inline area_t sparse() const {
+			area_t result{};
+
+			result.reserve(size());
+
+			each([&](usize index) { result.insert(unflatten(index)); });
+
+			return result;
+		}
+
+		template<typename T, extent_t BorderSize, typename U, bool Defer = false>
+			requires is_equatable<T, U>::value
+		constexpr ref<dense_area_t> collect(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			if constexpr (!Defer) {
+				clear();
+			}
+
+			for (usize k{ 0 }; k < word_count; ++k) {
+				const usize origin{ k * word_bits };
+				const usize count{ std::min(word_bits, area - origin) };
+
+				word_t word{ 0 };
+
+				for (usize i{ 0 }; i < count; ++i) {
+					word |= static_cast<word_t>(zone[static_cast<extent_t::product_t>(origin + i)] == value) << i;
+				}
+
+				words[k] |= word;
+			}
+
+			return *this;
+		}
+
+		// eight-way flood of the cells equal to value; inclusive also takes in the unequal cells bordering them
+		template<typename T, extent_t BorderSize, typename U, bool Defer = false>
+			requires is_equatable<T, U>::value
+		inline ref<dense_area_t> flood(cref<zone_t<T, Size, BorderSize>> zone, offset_t position, cref<U> value, bool inclusive = false) {
+			if constexpr (!Defer) {
+				clear();
+			}
+
+			if (!within(position) || zone[position] != value) {
+				return *this;
+			}
+
+			std::vector<offset_t> frontier{};
+
+			frontier.push_back(position);
+			insert(position);
+
+			while (!frontier.empty()) {
+				const offset_t current{ frontier.back() };
+				frontier.pop_back();
+
+				for (offset_t::scalar_t y{ -1 }; y <= 1; ++y) {
+					for (offset_t::scalar_t x{ -1 }; x <= 1; ++x) {
+						if (x == 0 && y == 0) {
+							continue;
+						}
+
+						const offset_t neighbour{ current.x + x, current.y + y };
+
+						if (!within(neighbour) || contains(neighbour)) {
+							continue;
+						}
+
+						if (zone[neighbour] != value) {
+							if (inclusive) {
+								insert(neighbour);
+							}
+
+							continue;
+						}
+
+						frontier.push_back(neighbour);
+						insert(neighbour);
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		// the cells visible from position by symmetric shadowcasting, where cells unequal to value block sight but are themselves seen
+		template<typename T, extent_t BorderSize, typename U, bool Defer = false>
+			requires is_equatable<T, U>::value
+		inline ref<dense_area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, offset_t position, f64 radius, bool inclusive = false) noexcept {
+			if constexpr (!Defer) {
+				clear();
+			}
+
+			if (!within(position) || zone[position] != value) {
+				return *this;
+			}
+
+			if (inclusive) {
+				surround(position);
+			}
+
+			shadowcaster_t::local().cast<Size>(position, radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) { mark(cell); });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename U, bool Defer = false>
+			requires is_equatable<T, U>::value
+		inline ref<dense_area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<circle_t> circle, bool inclusive = false) noexcept {
+			return cast<T, BorderSize, U, Defer>(zone, value, circle.position, circle.radius, inclusive);
+		}
+
+		template<typename T, extent_t BorderSize, typename U, bool Defer = false>
+			requires is_equatable<T, U>::value
+		inline ref<dense_area_t> cast(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<arc_t> arc, bool inclusive = false) noexcept {
+			if constexpr (!Defer) {
+				clear();
+			}
+
+			if (!within(arc.position) || zone[arc.position] != value) {
+				return *this;
+			}
+
+			if (inclusive) {
+				surround(arc.position);
+			}
+
+			const sector_t sector{ arc.angle, arc.span };
+
+			shadowcaster_t::local().cast<Size>(arc.position, arc.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (sector.contains(cell - arc.position)) {
+					mark(cell);
+				}
+			});
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires std::is_assignable<ref<T>, U>::value
+		constexpr cref<dense_area_t> set(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+			each([&](usize index) { zone[static_cast<extent_t::product_t>(index)] = value; });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_operable<T, U, operator_e::Addition>::value
+		constexpr cref<dense_area_t> apply(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+			each([&](usize index) { zone[static_cast<extent_t::product_t>(index)] += value; });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename... Params>
+			requires(is_operable<T, Params, operator_e::Addition>::value, ...) && is_plurary<Params...>::value
+		constexpr cref<dense_area_t> apply(ref<zone_t<T, Size, BorderSize>> zone, cref<Params>... values) const noexcept {
+			each([&](usize index) { ((zone[static_cast<extent_t::product_t>(index)] += values), ...); });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_operable<T, U, operator_e::Subtraction>::value
+		constexpr cref<dense_area_t> repeal(ref<zone_t<T, Size, BorderSize>> zone, cref<U> value) const noexcept {
+			each([&](usize index) { zone[static_cast<extent_t::product_t>(index)] -= value; });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename... Params>
+			requires(is_operable<T, Params, operator_e::Subtraction>::value, ...) && is_plurary<Params...>::value
+		constexpr cref<dense_area_t> repeal(ref<zone_t<T, Size, BorderSize>> zone, cref<Params>... values) const noexcept {
+			each([&](usize index) { ((zone[static_cast<extent_t::product_t>(index)] -= values), ...); });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, RandomEngine Generator> inline cref<dense_area_t> randomize(ref<zone_t<T, Size, BorderSize>> zone, ref<Generator> generator, f64 probability, cref<binary_applicator_t<T>> applicator) const noexcept {
+			std::bernoulli_distribution dis{ probability };
+
+			each([&](usize index) { zone[static_cast<extent_t::product_t>(index)] = applicator(generator, dis); });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, RandomEngine Generator> inline cref<dense_area_t> randomize(ref<zone_t<T, Size, BorderSize>> zone, ref<Generator> generator, f64 probability, cref<T> true_value, cref<T> false_value) const noexcept {
+			std::bernoulli_distribution dis{ probability };
+
+			each([&](usize index) { zone[static_cast<extent_t::product_t>(index)] = dis(generator) ? true_value : false_value; });
+
+			return *this;
+		}
+	};
+} // namespace bleak
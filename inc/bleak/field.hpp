@@ -2,10 +2,16 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <optional>
-#include <queue>
+#include <type_traits>
+#include <vector>
 
+#include <bleak/binarray.hpp>
+#include <bleak/bucket.hpp>
 #include <bleak/concepts.hpp>
+#include <bleak/creeper.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
@@ -19,349 +25,550 @@ namespace bleak {
 		zone_t<D, ZoneSize, ZoneBorder> distances;
 		sparse_t<D> goals;
 
-	  public:
-		static constexpr D goal_value{ 0 };
-		static constexpr D obstacle_value{ ZoneSize.area() };
-
-		static constexpr D close_to_obstacle_value{ obstacle_value - 1 };
+		using frontier_t = std::conditional<is_integer<D>::value, bucket_queue_t<D>, std::vector<creeper_t<D>>>::type;
 
-		constexpr bool goal_reached(offset_t position) const noexcept { return distances[position] == goal_value; }
-
-		constexpr bool goal_reached(offset_t position, D threshold) const noexcept { return distances[position] <= threshold; }
+		static constexpr D maximum_step{ []() -> D {
+			D maximum{ 0 };
 
-		constexpr bool obstacle_reached(offset_t position) const noexcept { return distances[position] >= close_to_obstacle_value; }
-
-		constexpr bool obstacle_reached(offset_t position, D threshold) const noexcept { return distances[position] >= close_to_obstacle_value - threshold; }
+			for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+				maximum = std::max(maximum, creeper.distance);
+			}
 
-		constexpr field_t() noexcept : distances{}, goals{} { clear<region_e::All>(); }
+			return maximum;
+		}() };
 
-		template<typename... Goals>
-			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
-			clear<region_e::All>();
+		static constexpr frontier_t make_frontier() noexcept {
+			if constexpr (is_integer<D>::value) {
+				return frontier_t{ static_cast<usize>(maximum_step) + 1 };
+			} else {
+				return frontier_t{};
+			}
 		}
 
-		template<typename T, typename... Goals>
-			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
-			recalculate<region_e::All>(zone, value);
-		}
+		frontier_t frontier{ make_frontier() };
 
-		template<typename... Goals>
-			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
-			clear<region_e::All>();
-		}
+		binarray_t<ZoneSize> reached;
+		binarray_t<ZoneSize> settled;
 
-		template<region_e Region, typename T, typename... Goals>
-			requires is_homogeneous<D, Goals...>::value
-		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
-			recalculate<region_e::All>(zone, value);
-		}
+		std::vector<offset_t> invalidated;
+		std::vector<offset_t> revised;
 
-		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> clear() noexcept {
-			distances.dependent set<Region>(obstacle_value);
+		// row-major scratch for the raster sweep, with the obstacle value as the ceiling of every cell it may not lower
+		std::vector<D> sweeping;
+		std::vector<D> ceilings;
 
-			return *this;
+		constexpr void seed(offset_t position, D distance) noexcept {
+			if constexpr (is_integer<D>::value) {
+				frontier.seed(position, distance);
+			} else {
+				push(position, distance);
+			}
 		}
 
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> reset() noexcept {
-			clear<region_e::All>();
-			goals.clear();
+		// saturated cells keep their distance but are never expanded, since every step beyond them saturates too and the buckets would have to widen to span the gap
+		constexpr void push(offset_t position, D distance) noexcept {
+			if (distance >= close_to_obstacle_value) {
+				return;
+			}
 
-			return *this;
+			if constexpr (is_integer<D>::value) {
+				frontier.push(position, distance);
+			} else {
+				frontier.emplace_back(position, distance);
+				std::push_heap(frontier.begin(), frontier.end(), typename creeper_t<D>::less{});
+			}
 		}
 
-		constexpr D at(offset_t position) const noexcept { return distances[position]; }
-
-		constexpr void homogenize() noexcept {
-			for (usize i{ 0 }; i < ZoneSize.area(); ++i) {
-				const D distance{ distances[i] };
+		constexpr creeper_t<D> pop() noexcept {
+			if constexpr (is_integer<D>::value) {
+				return frontier.pop();
+			} else {
+				std::pop_heap(frontier.begin(), frontier.end(), typename creeper_t<D>::less{});
 
-				if (distance >= 1) {
-					continue;
-				}
+				const creeper_t<D> current{ frontier.back() };
+				frontier.pop_back();
 
-				distances[i] = (distance < 1 && distance > -1) ? 0 : std::abs(distance);
+				return current;
 			}
 		}
 
-		template<region_e Region, typename T> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value) noexcept {
-			clear();
-
+		// dijkstra from the goals over traversable cells within the region that also satisfy passable; goals need only be traversable
+		template<region_e Region, typename Traversable, typename Passable, typename Step> constexpr void propagate(Traversable traversable, Passable passable, Step step) noexcept {
 			if (goals.empty()) {
-				return *this;
+				return;
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+			frontier.clear();
+
+			reached.reset();
+			settled.reset();
 
 			bool negative_goal{ false };
 
 			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
+				if (!distances.dependent within<Region>(g_pos) || !traversable(g_pos)) {
 					continue;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				reached[g_pos] = true;
+				distances[g_pos] = g_val;
+
+				seed(g_pos, g_val);
 
 				if (g_val < 0) {
 					negative_goal = true;
 				}
 			}
 
-			if (frontier.empty()) {
-				return *this;
-			}
-
 			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+				const creeper_t<D> current{ pop() };
 
-				visited.insert(current.position);
+				if (settled[current.position] || current.distance > distances[current.position]) {
+					continue;
+				}
 
-				distances[current.position] = current.distance;
+				settled[current.position] = true;
 
-				for (cauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					const offset_t offset_position{ current.position + creeper.posititon };
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+					cauto offset_position{ current.position + creeper.position };
 
-					if (visited.contains(offset_position) || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						if (!visited.contains(offset_position)) {
-							visited.insert(offset_position);
-						}
+					if (!distances.dependent within<Region>(offset_position) || settled[offset_position] || !traversable(offset_position) || !passable(offset_position)) {
+						continue;
+					}
+
+					const D offset_distance{ extend(current.distance, step(creeper, offset_position)) };
 
+					if (reached[offset_position] && offset_distance >= distances[offset_position]) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					reached[offset_position] = true;
+					distances[offset_position] = offset_distance;
+
+					push(offset_position, offset_distance);
 				}
 			}
 
 			if (negative_goal) {
 				homogenize();
 			}
+		}
 
-			return *this;
+		static constexpr D unit_step(cref<creeper_t<D>> creeper, offset_t) noexcept { return creeper.distance; }
+
+		// a neighbourhood step scaled by the cost of entering a cell, saturating short of the obstacle value rather than wrapping a narrow distance type
+		template<Numeric C> static constexpr D weigh(cref<creeper_t<D>> creeper, C cost) noexcept {
+			const f64 product{ static_cast<f64>(creeper.distance) * static_cast<f64>(cost) };
+
+			return product < static_cast<f64>(close_to_obstacle_value) ? static_cast<D>(product) : close_to_obstacle_value;
 		}
 
-		template<region_e Region, typename T, typename U>
-			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value) noexcept {
-			clear<Region>();
+		// the distance one step further on, saturating short of the obstacle value so that a reached cell never wraps or reads as unreached
+		static constexpr D extend(D distance, D step) noexcept {
+			if constexpr (is_integer<D>::value) {
+				D sum{};
 
-			if (goals.empty()) {
-				return *this;
+				if (__builtin_add_overflow(distance, step, &sum) || sum > close_to_obstacle_value) {
+					return close_to_obstacle_value;
+				}
+
+				return sum;
+			} else {
+				return std::min<D>(distance + step, close_to_obstacle_value);
 			}
+		}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+		static constexpr bool sweep_eligible{ DistanceFunction == distance_function_e::Chebyshev || DistanceFunction == distance_function_e::Manhattan || DistanceFunction == distance_function_e::VonNeumann };
 
-			bool negative_goal{ false };
+		static constexpr u32 sweep_limit{ 6 };
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
-				}
+		// the distance a unit step beyond a cell, saturating at the obstacle value so that unreached cells never seed their neighbours
+		static constexpr D sweep_step(D distance) noexcept { return distance < obstacle_value ? static_cast<D>(distance + 1) : distance; }
 
-				frontier.emplace(g_pos, g_val);
+		// lowers a cell toward a candidate unless its ceiling, the obstacle value for cells the sweep may not lower, holds it in place
+		static constexpr void sweep_lower(ref<D> distance, D candidate, D ceiling, ref<usize> changes) noexcept {
+			const D lowered{ std::min(distance, std::max(candidate, ceiling)) };
 
-				if (g_val < 0) {
-					negative_goal = true;
-				}
-			}
+			changes += lowered != distance;
+			distance = lowered;
+		}
 
-			if (frontier.empty()) {
-				return *this;
-			}
+		// relaxes a row against its predecessor in sweep order and then along itself; the vertical step is a plain select over contiguous rows and vectorizes
+		constexpr usize sweep_row(extent_t::scalar_t y, extent_t::scalar_t neighbour_y, bool forward) noexcept {
+			constexpr usize width{ static_cast<usize>(ZoneSize.w) };
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			const ptr<D> row{ sweeping.data() + static_cast<usize>(y) * width };
+			const cptr<D> ceiling{ ceilings.data() + static_cast<usize>(y) * width };
 
-				visited.insert(current.position);
+			usize changes{ 0 };
 
-				distances[current.position] = current.distance;
+			if (neighbour_y >= 0 && neighbour_y < ZoneSize.h) {
+				const cptr<D> neighbour{ sweeping.data() + static_cast<usize>(neighbour_y) * width };
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+				if constexpr (DistanceFunction == distance_function_e::Chebyshev) {
+					if constexpr (width == 1) {
+						sweep_lower(row[0], sweep_step(neighbour[0]), ceiling[0], changes);
+					} else {
+						sweep_lower(row[0], sweep_step(std::min(neighbour[0], neighbour[1])), ceiling[0], changes);
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						continue;
-					}
+						for (usize x{ 1 }; x < width - 1; ++x) {
+							sweep_lower(row[x], sweep_step(std::min(std::min(neighbour[x - 1], neighbour[x]), neighbour[x + 1])), ceiling[x], changes);
+						}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+						sweep_lower(row[width - 1], sweep_step(std::min(neighbour[width - 2], neighbour[width - 1])), ceiling[width - 1], changes);
+					}
+				} else {
+					for (usize x{ 0 }; x < width; ++x) {
+						sweep_lower(row[x], sweep_step(neighbour[x]), ceiling[x], changes);
+					}
 				}
 			}
 
-			if (negative_goal) {
-				homogenize();
+			if (forward) {
+				for (usize x{ 1 }; x < width; ++x) {
+					sweep_lower(row[x], sweep_step(row[x - 1]), ceiling[x], changes);
+				}
+			} else {
+				for (usize x{ width - 1 }; x > 0; --x) {
+					sweep_lower(row[x - 1], sweep_step(row[x]), ceiling[x - 1], changes);
+				}
 			}
 
-			return *this;
+			return changes;
 		}
 
-		template<region_e Region, typename T, SparseBlockage Blockage> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockage> blockage) noexcept {
-			clear();
+		// raster distance transform for unit-cost neighbourhoods; alternating forward and backward sweeps until nothing changes, or false once they stop paying off
+		template<region_e Region, typename Traversable, typename Passable> constexpr bool sweep(Traversable traversable, Passable passable) noexcept {
+			sweeping.assign(ZoneSize.area(), obstacle_value);
+			ceilings.resize(ZoneSize.area());
 
-			if (goals.empty()) {
-				return *this;
-			}
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+					const bool open{ distances.dependent within<Region>(position) && traversable(position) && passable(position) };
 
-			bool negative_goal{ false };
+					ceilings[static_cast<usize>(y) * ZoneSize.w + x] = open ? 0 : obstacle_value;
+				}
+			}
 
 			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
+				if (!distances.dependent within<Region>(g_pos) || !traversable(g_pos)) {
 					continue;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				sweeping[static_cast<usize>(g_pos.y) * ZoneSize.w + g_pos.x] = g_val;
+			}
 
-				if (g_val < 0) {
-					negative_goal = true;
+			usize previous{ 0 };
+
+			for (u32 pass{ 0 }; pass < sweep_limit; ++pass) {
+				usize changes{ 0 };
+
+				for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+					changes += sweep_row(y, y - 1, true);
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				for (extent_t::scalar_t y{ static_cast<extent_t::scalar_t>(ZoneSize.h - 1) }; y >= 0; --y) {
+					changes += sweep_row(y, y + 1, false);
+				}
+
+				if (changes == 0) {
+					// only cells a goal actually reached are marked, leaving open ground cut off from every goal unreached as dijkstra would
+					for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+						for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+							const offset_t position{ x, y };
+							const D swept{ sweeping[static_cast<usize>(y) * ZoneSize.w + x] };
+
+							reached[position] = swept < obstacle_value;
+							distances[position] = reached[position] ? swept : distances[position];
+						}
+					}
+
+					return true;
+				}
+
+				// open ground settles within a few pairs with the changes at least halving each time; mazes and winding corridors do not, and are left to dijkstra
+				if (pass > 0 && changes * 2 > previous) {
+					return false;
+				}
+
+				previous = changes;
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			return false;
+		}
 
-				visited.insert(current.position);
+		template<region_e Region, typename Traversable, typename Passable> constexpr void propagate(Traversable traversable, Passable passable) noexcept {
+			if constexpr (sweep_eligible) {
+				if (goals.empty()) {
+					return;
+				}
 
-				distances[current.position] = current.distance;
+				bool uniform_goals{ true };
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+				for (crauto [g_pos, g_val] : goals) {
+					if (g_val != goal_value) {
+						uniform_goals = false;
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || blockage.contains(offset_position)) {
-						continue;
+						break;
 					}
+				}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+				if (uniform_goals && sweep<Region>(traversable, passable)) {
+					return;
 				}
 			}
 
-			if (negative_goal) {
-				homogenize();
-			}
+			propagate<Region>(traversable, passable, unit_step);
+		}
 
-			return *this;
+		template<region_e Region, typename T, typename U, typename Passable>
+			requires is_equatable<T, U>::value
+		constexpr void propagate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, Passable passable) noexcept {
+			propagate<Region>([&](offset_t position) -> bool { return zone[position] == value; }, passable);
 		}
 
-		template<region_e Region, typename T, typename U, SparseBlockage Blockage>
+		// invalidates every cell whose distance was derived through a changed cell, then reseeds them from the intact boundary and relaxes outward; step must be the one the field was built with
+		template<region_e Region, typename T, typename U, typename Passable, typename Step>
 			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
-			clear<Region>();
+		constexpr void reconcile(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, Passable passable, Step step) noexcept {
+			cauto is_traversable{ [&](offset_t position) -> bool { return zone[position] == value; } };
 
-			if (goals.empty()) {
-				return *this;
-			}
+			for (crauto [g_pos, g_val] : goals) {
+				if (g_val < 0) {
+					clear<Region>();
+					propagate<Region>(is_traversable, passable, step);
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+					revised.clear();
 
-			bool negative_goal{ false };
+					for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+						for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+							revised.emplace_back(x, y);
+						}
+					}
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
+					return;
 				}
+			}
 
-				frontier.emplace(g_pos, g_val);
+			cauto is_passable{ [&](offset_t position) -> bool { return is_traversable(position) && passable(position); } };
 
-				if (g_val < 0) {
-					negative_goal = true;
+			frontier.clear();
+			invalidated.clear();
+			revised.clear();
+
+			reached.reset();
+
+			for (cauto change : changes) {
+				if (!zone.dependent within<Region>(change) || reached[change]) {
+					continue;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				reached[change] = true;
+				invalidated.push_back(change);
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			for (usize i{ 0 }; i < invalidated.size(); ++i) {
+				const offset_t current{ invalidated[i] };
+				const D current_distance{ distances[current] };
 
-				visited.insert(current.position);
+				distances[current] = obstacle_value;
 
-				distances[current.position] = current.distance;
+				if (current_distance == obstacle_value) {
+					continue;
+				}
 
 				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+					cauto offset_position{ current + creeper.position };
+
+					if (!zone.dependent within<Region>(offset_position) || reached[offset_position]) {
+						continue;
+					}
+
+					const D offset_distance{ distances[offset_position] };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || sparse_blockage.contains(offset_position)) {
+					if (offset_distance == obstacle_value || offset_distance < extend(current_distance, step(creeper, offset_position))) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					reached[offset_position] = true;
+					invalidated.push_back(offset_position);
 				}
 			}
 
-			if (negative_goal) {
-				homogenize();
-			}
+			for (cauto position : invalidated) {
+				cauto goal{ goals[position] };
 
-			return *this;
-		}
+				// goals need only be traversable, as when propagating
+				if (goal != nullptr ? !is_traversable(position) : !is_passable(position)) {
+					continue;
+				}
 
-		template<region_e Region, typename T, SparseBlockage... Blockages>
-			requires is_plurary<Blockages...>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
-			clear();
+				D best{ goal != nullptr ? *goal : obstacle_value };
 
-			if (goals.empty()) {
-				return *this;
-			}
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
+					cauto offset_position{ position + creeper.position };
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+					if (!zone.dependent within<Region>(offset_position) || reached[offset_position] || distances[offset_position] == obstacle_value || !is_passable(position)) {
+						continue;
+					}
 
-			bool negative_goal{ false };
+					best = std::min(best, extend(distances[offset_position], step(creeper, position)));
+				}
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
+				if (best == obstacle_value) {
 					continue;
 				}
 
-				frontier.emplace(g_pos, g_val);
+				distances[position] = best;
 
-				if (g_val < 0) {
-					negative_goal = true;
-				}
-			}
-
-			if (frontier.empty()) {
-				return *this;
+				seed(position, best);
 			}
 
 			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
-
-				visited.insert(current.position);
+				const creeper_t<D> current{ pop() };
 
-				distances[current.position] = current.distance;
+				if (current.distance > distances[current.position]) {
+					continue;
+				}
 
 				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
 					cauto offset_position{ current.position + creeper.position };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
+					if (!zone.dependent within<Region>(offset_position) || !is_passable(offset_position)) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					const D offset_distance{ extend(current.distance, step(creeper, offset_position)) };
+
+					if (offset_distance >= distances[offset_position]) {
+						continue;
+					}
+
+					distances[offset_position] = offset_distance;
+					revised.push_back(offset_position);
+
+					push(offset_position, offset_distance);
 				}
 			}
 
-			if (negative_goal) {
-				homogenize();
+			revised.insert(revised.end(), invalidated.begin(), invalidated.end());
+		}
+
+	  public:
+		static constexpr D goal_value{ 0 };
+		// beyond any distance a field can hold, so that weighted fields never mistake a reached cell for an unreached one
+		static constexpr D obstacle_value{ std::numeric_limits<D>::has_infinity ? std::numeric_limits<D>::infinity() : std::numeric_limits<D>::max() };
+
+		static constexpr D close_to_obstacle_value{ obstacle_value - 1 };
+
+		constexpr bool goal_reached(offset_t position) const noexcept { return distances[position] == goal_value; }
+
+		constexpr bool goal_reached(offset_t position, D threshold) const noexcept { return distances[position] <= threshold; }
+
+		constexpr bool obstacle_reached(offset_t position) const noexcept { return distances[position] >= close_to_obstacle_value; }
+
+		constexpr bool obstacle_reached(offset_t position, D threshold) const noexcept { return distances[position] >= close_to_obstacle_value - threshold; }
+
+		constexpr field_t() noexcept : distances{}, goals{} { clear<region_e::All>(); }
+
+		template<typename... Goals>
+			requires is_homogeneous<D, Goals...>::value
+		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+			clear<region_e::All>();
+		}
+
+		template<typename T, typename... Goals>
+			requires is_homogeneous<D, Goals...>::value
+		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+			recalculate<region_e::All>(zone, value);
+		}
+
+		template<typename... Goals>
+			requires is_homogeneous<D, Goals...>::value
+		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+			clear<region_e::All>();
+		}
+
+		template<region_e Region, typename T, typename... Goals>
+			requires is_homogeneous<D, Goals...>::value
+		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+			recalculate<region_e::All>(zone, value);
+		}
+
+		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> clear() noexcept {
+			distances.dependent set<Region>(obstacle_value);
+
+			return *this;
+		}
+
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> reset() noexcept {
+			clear<region_e::All>();
+			goals.clear();
+
+			return *this;
+		}
+
+		constexpr D at(offset_t position) const noexcept { return distances[position]; }
+
+		// cells whose distance may have changed during the last repair, possibly with repeats
+		constexpr cref<std::vector<offset_t>> revisions() const noexcept { return revised; }
+
+		constexpr void homogenize() noexcept {
+			for (usize i{ 0 }; i < ZoneSize.area(); ++i) {
+				const D distance{ distances[i] };
+
+				if (distance >= 1) {
+					continue;
+				}
+
+				distances[i] = (distance < 1 && distance > -1) ? 0 : std::abs(distance);
 			}
+		}
+
+		template<region_e Region, typename T> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value) noexcept {
+			clear<Region>();
+
+			propagate<Region>(zone, value, [](offset_t) -> bool { return true; });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value) noexcept {
+			clear<Region>();
+
+			propagate<Region>(zone, value, [](offset_t) -> bool { return true; });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, SparseBlockage Blockage> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockage> blockage) noexcept {
+			clear<Region>();
+
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return !blockage.contains(position); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, SparseBlockage Blockage>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
+			clear<Region>();
+
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return !sparse_blockage.contains(position); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, SparseBlockage... Blockages>
+			requires is_plurary<Blockages...>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
+			clear<Region>();
+
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); });
 
 			return *this;
 		}
@@ -371,53 +578,113 @@ namespace bleak {
 		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
 			clear<Region>();
 
-			if (goals.empty()) {
-				return *this;
-			}
+			propagate<Region>(zone, value, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); });
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			gtl::flat_hash_set<offset_t, offset_t::std_hasher> visited{};
+			return *this;
+		}
 
-			bool negative_goal{ false };
+		// entering a cell costs the neighbourhood step scaled by its cost, which must be non-negative
+		template<region_e Region, typename T, typename U, Numeric C>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<zone_t<C, ZoneSize, ZoneBorder>> costs) noexcept {
+			clear<Region>();
 
-			for (crauto [g_pos, g_val] : goals) {
-				if (!zone.dependent within<Region>(g_pos) || zone[g_pos] != value) {
-					continue;
-				}
+			propagate<Region>([&](offset_t position) -> bool { return zone[position] == value; }, [](offset_t) -> bool { return true; }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, costs[position]); });
 
-				frontier.emplace(g_pos, g_val);
+			return *this;
+		}
 
-				if (g_val < 0) {
-					negative_goal = true;
-				}
-			}
+		template<region_e Region, typename T, typename U, Numeric C, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<zone_t<C, ZoneSize, ZoneBorder>> costs, cref<Blockages>... blockages) noexcept {
+			clear<Region>();
 
-			if (frontier.empty()) {
-				return *this;
-			}
+			propagate<Region>([&](offset_t position) -> bool { return zone[position] == value; }, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, costs[position]); });
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			return *this;
+		}
 
-				visited.insert(current.position);
+		template<region_e Region, typename T, typename U, typename Cost>
+			requires is_equatable<T, U>::value && std::is_invocable_r<D, Cost, offset_t>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, Cost cost) noexcept {
+			clear<Region>();
 
-				distances[current.position] = current.distance;
+			propagate<Region>([&](offset_t position) -> bool { return zone[position] == value; }, [](offset_t) -> bool { return true; }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, cost(position)); });
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+			return *this;
+		}
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
-						continue;
-					}
+		template<region_e Region, typename T, typename U, typename Cost, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value && std::is_invocable_r<D, Cost, offset_t>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, Cost cost, cref<Blockages>... blockages) noexcept {
+			clear<Region>();
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
-				}
-			}
+			propagate<Region>([&](offset_t position) -> bool { return zone[position] == value; }, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, cost(position)); });
 
-			if (negative_goal) {
-				homogenize();
-			}
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<binarray_t<ZoneSize>> passable) noexcept {
+			clear<Region>();
+
+			propagate<Region>([&](offset_t position) -> bool { return passable[position]; }, [](offset_t) -> bool { return true; });
+
+			return *this;
+		}
+
+		template<region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<binarray_t<ZoneSize>> traversable, cref<binarray_t<ZoneSize>> passable) noexcept {
+			clear<Region>();
+
+			propagate<Region>([&](offset_t position) -> bool { return traversable[position]; }, [&](offset_t position) -> bool { return passable[position]; });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes) noexcept {
+			reconcile<Region>(zone, value, changes, [](offset_t) -> bool { return true; }, unit_step);
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, cref<Blockages>... blockages) noexcept {
+			reconcile<Region>(zone, value, changes, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); }, unit_step);
+
+			return *this;
+		}
+
+		// a weighted field must be repaired with the same costs it was recalculated with
+		template<region_e Region, typename T, typename U, Numeric C>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, cref<zone_t<C, ZoneSize, ZoneBorder>> costs) noexcept {
+			reconcile<Region>(zone, value, changes, [](offset_t) -> bool { return true; }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, costs[position]); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, Numeric C, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, cref<zone_t<C, ZoneSize, ZoneBorder>> costs, cref<Blockages>... blockages) noexcept {
+			reconcile<Region>(zone, value, changes, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, costs[position]); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, typename Cost>
+			requires is_equatable<T, U>::value && std::is_invocable_r<D, Cost, offset_t>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, Cost cost) noexcept {
+			reconcile<Region>(zone, value, changes, [](offset_t) -> bool { return true; }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, cost(position)); });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, typename Cost, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value && std::is_invocable_r<D, Cost, offset_t>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, Cost cost, cref<Blockages>... blockages) noexcept {
+			reconcile<Region>(zone, value, changes, [&](offset_t position) -> bool { return !(blockages.contains(position) || ...); }, [&](cref<creeper_t<D>> creeper, offset_t position) -> D { return weigh(creeper, cost(position)); });
 
 			return *this;
 		}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+
+#include <bleak/binarray.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/field.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder, usize Count> struct field_set_t {
+		static_assert(Count > 0, "field set must contain at least one field!");
+
+		using field_type = field_t<D, DistanceFunction, ZoneSize, ZoneBorder>;
+
+	  private:
+		std::array<field_type, Count> fields;
+
+		binarray_t<ZoneSize> traversable;
+		binarray_t<ZoneSize> passable;
+
+		template<region_e Region, typename T, typename U, typename Blocked>
+			requires is_equatable<T, U>::value
+		constexpr void scan(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, Blocked blocked) noexcept {
+			traversable.reset();
+			passable.reset();
+
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
+
+					if (!zone.dependent within<Region>(position) || zone[position] != value) {
+						continue;
+					}
+
+					traversable[position] = true;
+					passable[position] = !blocked(position);
+				}
+			}
+		}
+
+		template<region_e Region> constexpr void solve() noexcept {
+			thread_pool_t::shared().parallel_for(Count, [&](usize index) { fields[index].template recalculate<Region>(traversable, passable); });
+		}
+
+	  public:
+		static constexpr usize size{ Count };
+
+		constexpr field_set_t() noexcept : fields{}, traversable{}, passable{} {}
+
+		constexpr ref<field_type> operator[](usize index) noexcept { return fields[index]; }
+
+		constexpr cref<field_type> operator[](usize index) const noexcept { return fields[index]; }
+
+		constexpr cref<binarray_t<ZoneSize>> traversable_mask() const noexcept { return traversable; }
+
+		constexpr cref<binarray_t<ZoneSize>> passable_mask() const noexcept { return passable; }
+
+		// scans the zone once and recalculates every field against the shared masks, one field per task on the shared pool
+		template<region_e Region, typename T, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_set_t> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value) noexcept {
+			scan<Region>(zone, value, [](offset_t) -> bool { return false; });
+			solve<Region>();
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_set_t> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+			scan<Region>(zone, value, [&](offset_t position) -> bool { return (blockages.contains(position) || ...); });
+			solve<Region>();
+
+			return *this;
+		}
+
+		// recalculates against the masks from the last scan, for when only goals have moved
+		template<region_e Region> constexpr ref<field_set_t> recalculate() noexcept {
+			solve<Region>();
+
+			return *this;
+		}
+	};
+} // namespace bleak
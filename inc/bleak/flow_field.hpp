@@ -0,0 +1,169 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <bleak/binarray.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/field.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder> struct flow_field_t {
+		using field_type = field_t<D, DistanceFunction, ZoneSize, ZoneBorder>;
+
+		static constexpr auto directions{ neighbourhood_offsets<DistanceFunction> };
+
+		static constexpr u8 no_direction{ 0xFF };
+
+	  private:
+		field_type field;
+
+		zone_t<u8, ZoneSize, ZoneBorder> flow;
+
+		binarray_t<ZoneSize> marked;
+		std::vector<offset_t> pending;
+		std::vector<offset_t> moved;
+
+		// the index of the neighbour a step closer to the goals, or no_direction at a goal or where none are reachable; weighted distances may run well past the area, so only the field's own sentinel marks a cell as unreached
+		template<region_e Region> constexpr u8 steepest(offset_t position) const noexcept {
+			const D distance{ field.at(position) };
+
+			if (distance == field_type::obstacle_value || field.goal_reached(position)) {
+				return no_direction;
+			}
+
+			u8 lowest{ no_direction };
+			D lowest_distance{ distance };
+
+			for (u8 i{ 0 }; i < directions.size(); ++i) {
+				const offset_t offset_position{ position + directions[i] };
+
+				if (!flow.dependent within<Region>(offset_position)) {
+					continue;
+				}
+
+				const D offset_distance{ field.at(offset_position) };
+
+				if (offset_distance == field_type::obstacle_value || offset_distance >= lowest_distance) {
+					continue;
+				}
+
+				lowest = i;
+				lowest_distance = offset_distance;
+			}
+
+			return lowest;
+		}
+
+		template<region_e Region> constexpr void rebuild() noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
+
+					flow[position] = flow.dependent within<Region>(position) ? steepest<Region>(position) : no_direction;
+				}
+			}
+		}
+
+		// a cell's direction can only change if its own distance or that of a neighbour did
+		template<region_e Region> constexpr void refresh() noexcept {
+			marked.reset();
+			pending.clear();
+
+			cauto mark{ [&](offset_t position) {
+				if (!flow.dependent within<Region>(position) || marked[position]) {
+					return;
+				}
+
+				marked[position] = true;
+				pending.push_back(position);
+			} };
+
+			for (cauto position : field.revisions()) {
+				mark(position);
+
+				for (cauto direction : directions) {
+					mark(position + direction);
+				}
+			}
+
+			for (cauto position : pending) {
+				flow[position] = steepest<Region>(position);
+			}
+		}
+
+	  public:
+		constexpr flow_field_t() noexcept : field{}, flow{}, marked{}, pending{}, moved{} { flow.dependent set<region_e::All>(no_direction); }
+
+		constexpr cref<field_type> integration_field() const noexcept { return field; }
+
+		// goals may be edited freely through the integration field, so long as the flow is recalculated or repaired afterwards
+		constexpr ref<field_type> integration_field() noexcept { return field; }
+
+		constexpr u8 at(offset_t position) const noexcept { return flow[position]; }
+
+		constexpr std::optional<offset_t> direction(offset_t position) const noexcept {
+			const u8 index{ flow[position] };
+
+			if (index == no_direction) {
+				return std::nullopt;
+			}
+
+			return directions[index];
+		}
+
+		// the next step toward the nearest goal, in constant time regardless of how many agents share the flow
+		constexpr std::optional<offset_t> next(offset_t position) const noexcept {
+			const u8 index{ flow[position] };
+
+			if (index == no_direction) {
+				return std::nullopt;
+			}
+
+			return position + directions[index];
+		}
+
+		template<region_e Region, typename... Params> constexpr ref<flow_field_t> recalculate(cref<Params>... params) noexcept {
+			field.dependent recalculate<Region>(params...);
+
+			rebuild<Region>();
+
+			return *this;
+		}
+
+		// takes the same costs and blockages the flow was recalculated with, so weighted fields are repaired with their own step
+		template<region_e Region, typename T, typename U, typename... Params>
+			requires is_equatable<T, U>::value
+		constexpr ref<flow_field_t> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<std::vector<offset_t>> changes, cref<Params>... params) noexcept {
+			field.dependent repair<Region>(zone, value, changes, params...);
+
+			refresh<Region>();
+
+			return *this;
+		}
+
+		// moves a goal and repairs only the cells whose distances depended on either end of the move
+		template<region_e Region, typename T, typename U, typename... Params>
+			requires is_equatable<T, U>::value
+		constexpr bool retarget(offset_t from, offset_t to, cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Params>... params) noexcept {
+			if (!field.dependent update<Region>(from, to)) {
+				return false;
+			}
+
+			moved.clear();
+			moved.push_back(from);
+			moved.push_back(to);
+
+			field.dependent repair<Region>(zone, value, moved, params...);
+
+			refresh<Region>();
+
+			return true;
+		}
+	};
+} // namespace bleak
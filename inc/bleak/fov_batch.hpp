@@ -0,0 +1,243 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/shadowcaster.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct fov_batch_t {
+		using word_t = u64;
+		using viewer_index_t = u32;
+
+		struct viewer_t {
+			offset_t position;
+			f64 radius;
+
+			sector_t sector;
+		};
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr usize word_bits{ sizeof(word_t) * 8 };
+
+	  private:
+		// the cells a viewer could possibly see, clipped to the zone, and where its bits start
+		struct window_t {
+			rect_t bounds;
+
+			usize offset;
+		};
+
+		std::vector<viewer_t> viewers;
+		std::vector<window_t> windows;
+
+		// every viewer's bits back to back, each starting on a fresh word so that workers never share one
+		std::vector<word_t> words;
+
+		std::vector<usize> observer_offsets;
+		std::vector<viewer_index_t> observer_indices;
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr bool within(cref<rect_t> bounds, offset_t position) noexcept { return position.x >= bounds.position.x && position.y >= bounds.position.y && position.x < bounds.position.x + bounds.size.w && position.y < bounds.position.y + bounds.size.h; }
+
+		static constexpr usize bit_of(cref<rect_t> bounds, offset_t position) noexcept { return static_cast<usize>(position.y - bounds.position.y) * static_cast<usize>(bounds.size.w) + static_cast<usize>(position.x - bounds.position.x); }
+
+		static inline rect_t bound(cref<viewer_t> viewer) noexcept {
+			if (!contains(viewer.position)) {
+				return rect_t{ viewer.position, extent_t{ 0, 0 } };
+			}
+
+			const i32 reach{ viewer.radius < 0.0 ? 0 : static_cast<i32>(viewer.radius) };
+
+			const offset_t minimum{ std::max<i32>(viewer.position.x - reach, 0), std::max<i32>(viewer.position.y - reach, 0) };
+			const offset_t maximum{ std::min<i32>(viewer.position.x + reach, Size.w - 1), std::min<i32>(viewer.position.y + reach, Size.h - 1) };
+
+			return rect_t{ minimum, extent_t{ maximum.x - minimum.x + 1, maximum.y - minimum.y + 1 } };
+		}
+
+		static constexpr usize words_of(cref<rect_t> bounds) noexcept { return (static_cast<usize>(bounds.size.w) * static_cast<usize>(bounds.size.h) + word_bits - 1) / word_bits; }
+
+		constexpr usize word_count(usize index) const noexcept { return index + 1 < windows.size() ? windows[index + 1].offset - windows[index].offset : words.size() - windows[index].offset; }
+
+		template<typename Visitor> constexpr void each_bit(usize index, Visitor visitor) const noexcept {
+			cref<window_t> window{ windows[index] };
+
+			const usize count{ word_count(index) };
+
+			for (usize k{ 0 }; k < count; ++k) {
+				word_t pending{ words[window.offset + k] };
+
+				while (pending != 0) {
+					const usize bit{ k * word_bits + static_cast<usize>(std::countr_zero(pending)) };
+
+					visitor(offset_t{ window.bounds.position.x + static_cast<i32>(bit % static_cast<usize>(window.bounds.size.w)), window.bounds.position.y + static_cast<i32>(bit / static_cast<usize>(window.bounds.size.w)) });
+
+					pending &= pending - 1;
+				}
+			}
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline void resolve(usize index, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			cref<viewer_t> viewer{ viewers[index] };
+			cref<window_t> window{ windows[index] };
+
+			const ptr<word_t> bits{ words.data() + window.offset };
+
+			std::fill(bits, bits + word_count(index), word_t{ 0 });
+
+			if (!contains(viewer.position) || zone[viewer.position] != value) {
+				return;
+			}
+
+			shadowcaster_t::local().cast<Size>(viewer.position, viewer.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				if (!viewer.sector.contains(cell - viewer.position)) {
+					return;
+				}
+
+				const usize bit{ bit_of(window.bounds, cell) };
+
+				bits[bit / word_bits] |= word_t{ 1 } << (bit % word_bits);
+			});
+		}
+
+	  public:
+		inline fov_batch_t() noexcept : viewers{}, windows{}, words{}, observer_offsets{}, observer_indices{} {}
+
+		inline usize count() const noexcept { return viewers.size(); }
+
+		inline bool empty() const noexcept { return viewers.empty(); }
+
+		inline void reserve(usize capacity) noexcept {
+			viewers.reserve(capacity);
+			windows.reserve(capacity);
+		}
+
+		// drops the viewers and results but keeps every buffer for the next batch
+		inline void clear() noexcept {
+			viewers.clear();
+			windows.clear();
+			words.clear();
+
+			observer_offsets.clear();
+			observer_indices.clear();
+		}
+
+		inline usize submit(offset_t position, f64 radius) noexcept { return submit(position, radius, sector_t{}); }
+
+		// a viewer limited to a cone, with the angle and span in degrees as for arc_t
+		inline usize submit(offset_t position, f64 radius, f64 angle, f64 span) noexcept { return submit(position, radius, sector_t{ angle, span }); }
+
+		inline usize submit(offset_t position, f64 radius, cref<sector_t> sector) noexcept {
+			viewers.push_back(viewer_t{ position, radius, sector });
+
+			const rect_t bounds{ bound(viewers.back()) };
+
+			windows.push_back(window_t{ bounds, words.size() });
+
+			words.resize(words.size() + words_of(bounds));
+
+			return viewers.size() - 1;
+		}
+
+		// casts every viewer across the shared pool against a zone that must not be written to until this returns; cells unequal to value block sight
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<fov_batch_t> solve(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			observer_offsets.clear();
+			observer_indices.clear();
+
+			thread_pool_t::shared().parallel_for(viewers.size(), [&](usize index) { resolve(index, zone, value); });
+
+			return *this;
+		}
+
+		inline cref<viewer_t> viewer(usize index) const noexcept { return viewers[index]; }
+
+		inline rect_t bounds(usize index) const noexcept { return windows[index].bounds; }
+
+		// the viewer's bits in row-major order over its bounds
+		inline std::span<const word_t> bitmap(usize index) const noexcept { return std::span<const word_t>{ words.data() + windows[index].offset, word_count(index) }; }
+
+		inline bool visible(usize index, offset_t position) const noexcept {
+			cref<window_t> window{ windows[index] };
+
+			if (!within(window.bounds, position)) {
+				return false;
+			}
+
+			const usize bit{ bit_of(window.bounds, position) };
+
+			return (words[window.offset + bit / word_bits] >> (bit % word_bits)) & word_t{ 1 };
+		}
+
+		// how many cells the viewer sees
+		inline usize visible_count(usize index) const noexcept {
+			usize total{ 0 };
+
+			for (cauto word : bitmap(index)) {
+				total += static_cast<usize>(std::popcount(word));
+			}
+
+			return total;
+		}
+
+		template<typename Visitor> inline void each(usize index, Visitor visitor) const noexcept { each_bit(index, visitor); }
+
+		// builds the reverse index from each cell to the viewers that see it; call after solve when perception queries run per cell
+		inline ref<fov_batch_t> index_observers() noexcept {
+			observer_offsets.assign(area + 1, 0);
+
+			for (usize i{ 0 }; i < viewers.size(); ++i) {
+				each_bit(i, [&](offset_t cell) { ++observer_offsets[flatten(cell) + 1]; });
+			}
+
+			for (usize i{ 0 }; i < area; ++i) {
+				observer_offsets[i + 1] += observer_offsets[i];
+			}
+
+			observer_indices.resize(observer_offsets.back());
+
+			std::vector<usize> cursors(observer_offsets.begin(), observer_offsets.end() - 1);
+
+			for (usize i{ 0 }; i < viewers.size(); ++i) {
+				each_bit(i, [&](offset_t cell) { observer_indices[cursors[flatten(cell)]++] = static_cast<viewer_index_t>(i); });
+			}
+
+			return *this;
+		}
+
+		inline bool indexed() const noexcept { return !observer_offsets.empty(); }
+
+		// the viewers that see a cell in ascending order, empty until index_observers has been called
+		inline std::span<const viewer_index_t> observers(offset_t position) const noexcept {
+			if (!indexed() || !contains(position)) {
+				return std::span<const viewer_index_t>{};
+			}
+
+			const usize cell{ flatten(position) };
+
+			return std::span<const viewer_index_t>{ observer_indices.data() + observer_offsets[cell], observer_offsets[cell + 1] - observer_offsets[cell] };
+		}
+
+		inline bool observed(offset_t position) const noexcept { return !observers(position).empty(); }
+	};
+} // namespace bleak
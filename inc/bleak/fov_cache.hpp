@@ -0,0 +1,190 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <bleak/arc.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/dense_area.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// serves the fields of view cast over a single zone for one transparent value type; each slot remembers the value it was cast with
+	template<extent_t Size, typename Value, extent_t ChunkSize = extent_t{ 8, 8 }> struct fov_cache_t {
+		static constexpr extent_t size{ Size };
+		static constexpr extent_t chunk_size{ ChunkSize };
+
+		static constexpr extent_t chunk_count{ (Size.w + ChunkSize.w - 1) / ChunkSize.w, (Size.h + ChunkSize.h - 1) / ChunkSize.h };
+
+		static_assert(ChunkSize.w > 0 && ChunkSize.h > 0, "chunk size must be greater than zero!");
+		static_assert(is_equatable<Value, Value>::value && std::is_default_constructible<Value>::value, "transparent value must be equatable and default constructible!");
+
+	  private:
+		struct entry_t {
+			offset_t position;
+			f64 radius;
+
+			f64 angle;
+			f64 span;
+
+			Value value;
+
+			// the version the zone was at when this result was cast
+			u64 version;
+
+			bool occupied;
+
+			dense_area_t<Size> area;
+		};
+
+		std::vector<entry_t> entries;
+
+		// the version at which any cell in each chunk last changed opacity
+		std::vector<u64> chunk_versions;
+
+		u64 current_version;
+
+		usize hit_count;
+		usize miss_count;
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		static constexpr usize chunk_of(offset_t position) noexcept { return static_cast<usize>(position.y / ChunkSize.h) * static_cast<usize>(chunk_count.w) + static_cast<usize>(position.x / ChunkSize.w); }
+
+		static constexpr bool same(f64 lhs, f64 rhs) noexcept { return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs)); }
+
+		// whether no chunk under the viewer's radius has changed since its result was cast
+		constexpr bool fresh(cref<entry_t> entry) const noexcept {
+			const i32 reach{ static_cast<i32>(entry.radius) };
+
+			const i32 min_x{ std::max<i32>(entry.position.x - reach, 0) / ChunkSize.w };
+			const i32 min_y{ std::max<i32>(entry.position.y - reach, 0) / ChunkSize.h };
+			const i32 max_x{ std::min<i32>(entry.position.x + reach, Size.w - 1) / ChunkSize.w };
+			const i32 max_y{ std::min<i32>(entry.position.y + reach, Size.h - 1) / ChunkSize.h };
+
+			for (i32 y{ min_y }; y <= max_y; ++y) {
+				for (i32 x{ min_x }; x <= max_x; ++x) {
+					if (chunk_versions[static_cast<usize>(y) * static_cast<usize>(chunk_count.w) + static_cast<usize>(x)] > entry.version) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		inline ref<entry_t> slot(usize viewer) noexcept {
+			if (viewer >= entries.size()) {
+				entries.resize(viewer + 1);
+			}
+
+			return entries[viewer];
+		}
+
+	  public:
+		inline fov_cache_t() noexcept : entries{}, chunk_versions(static_cast<usize>(chunk_count.w) * static_cast<usize>(chunk_count.h), 0), current_version{ 0 }, hit_count{ 0 }, miss_count{ 0 } {}
+
+		inline usize capacity() const noexcept { return entries.size(); }
+
+		inline u64 version() const noexcept { return current_version; }
+
+		inline usize hits() const noexcept { return hit_count; }
+
+		inline usize misses() const noexcept { return miss_count; }
+
+		inline f64 hit_rate() const noexcept {
+			const usize total{ hit_count + miss_count };
+
+			return total == 0 ? 0.0 : static_cast<f64>(hit_count) / static_cast<f64>(total);
+		}
+
+		inline void reset_statistics() noexcept {
+			hit_count = 0;
+			miss_count = 0;
+		}
+
+		// slots grow on demand, so reserving up front keeps earlier results in place when a new viewer is first cast
+		inline void reserve(usize viewers) noexcept { entries.reserve(viewers); }
+
+		// the cells the viewer in this slot sees, recast only if it moved, changed its radius, cone or transparent value, or a cell under its radius changed opacity
+		template<typename T, extent_t BorderSize>
+			requires is_equatable<T, Value>::value
+		inline cref<dense_area_t<Size>> cast(usize viewer, cref<zone_t<T, Size, BorderSize>> zone, cref<Value> value, offset_t position, f64 radius, f64 angle = std::numeric_limits<f64>::quiet_NaN(), f64 span = std::numeric_limits<f64>::quiet_NaN()) noexcept {
+			ref<entry_t> entry{ slot(viewer) };
+
+			if (entry.occupied && entry.position == position && entry.radius == radius && same(entry.angle, angle) && same(entry.span, span) && entry.value == value && fresh(entry)) {
+				++hit_count;
+
+				return entry.area;
+			}
+
+			++miss_count;
+
+			entry.position = position;
+			entry.radius = radius;
+			entry.angle = angle;
+			entry.span = span;
+			entry.value = value;
+			entry.version = current_version;
+			entry.occupied = true;
+
+			if (std::isnan(angle) || std::isnan(span)) {
+				entry.area.cast(zone, value, position, radius);
+			} else {
+				entry.area.cast(zone, value, arc_t{ position, radius, angle, span });
+			}
+
+			return entry.area;
+		}
+
+		// the last result cast for the slot, which may be stale
+		inline cref<dense_area_t<Size>> operator[](usize viewer) const noexcept { return entries[viewer].area; }
+
+		inline bool cached(usize viewer) const noexcept { return viewer < entries.size() && entries[viewer].occupied; }
+
+		inline ref<fov_cache_t> forget(usize viewer) noexcept {
+			if (viewer < entries.size()) {
+				entries[viewer].occupied = false;
+			}
+
+			return *this;
+		}
+
+		// marks a cell whose opacity changed, retiring only the viewers whose radius reaches its chunk
+		inline ref<fov_cache_t> invalidate(offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			chunk_versions[chunk_of(position)] = ++current_version;
+
+			return *this;
+		}
+
+		inline ref<fov_cache_t> invalidate(cref<std::vector<offset_t>> positions) noexcept {
+			for (cauto position : positions) {
+				invalidate(position);
+			}
+
+			return *this;
+		}
+
+		// retires every cached result at once
+		inline ref<fov_cache_t> invalidate() noexcept {
+			++current_version;
+
+			for (rauto entry : entries) {
+				entry.occupied = false;
+			}
+
+			return *this;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct jump_table_t {
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr std::array<offset_t, 4> directions{ offset_t::North, offset_t::South, offset_t::West, offset_t::East };
+
+	  private:
+		// positive entries are the step count to the next jump point, non-positive entries the negated count of open steps before a wall
+		std::vector<i32> jumps;
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+	  public:
+		inline jump_table_t() noexcept : jumps(directions.size() * area, 0) {}
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		static constexpr usize direction_index(offset_t direction) noexcept {
+			if (direction == offset_t::North) {
+				return 0;
+			} else if (direction == offset_t::South) {
+				return 1;
+			} else if (direction == offset_t::West) {
+				return 2;
+			}
+
+			return 3;
+		}
+
+		// a cell entered travelling along a straight direction is a jump point if either side is blocked while the cell diagonally ahead on that side is open
+		template<typename Walkable> static constexpr bool is_forced(offset_t position, offset_t direction, Walkable walkable) noexcept {
+			const offset_t left{ direction.y, direction.x };
+			const offset_t right{ -left };
+
+			return (walkable(position + left + direction) && !walkable(position + left)) || (walkable(position + right + direction) && !walkable(position + right));
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<jump_table_t> build(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			cauto walkable{ [&](offset_t position) -> bool { return contains(position) && zone.dependent within<Region>(position) && zone[position] == value; } };
+
+			for (cauto direction : directions) {
+				const usize base{ direction_index(direction) * area };
+
+				const bool reverse_x{ direction.x > 0 };
+				const bool reverse_y{ direction.y > 0 };
+
+				for (extent_t::scalar_t j{ 0 }; j < Size.h; ++j) {
+					const extent_t::scalar_t y{ reverse_y ? static_cast<extent_t::scalar_t>(Size.h - 1 - j) : j };
+
+					for (extent_t::scalar_t i{ 0 }; i < Size.w; ++i) {
+						const extent_t::scalar_t x{ reverse_x ? static_cast<extent_t::scalar_t>(Size.w - 1 - i) : i };
+
+						const offset_t position{ x, y };
+						const offset_t next{ position + direction };
+
+						if (!walkable(next)) {
+							jumps[base + flatten(position)] = 0;
+						} else if (is_forced(next, direction, walkable)) {
+							jumps[base + flatten(position)] = 1;
+						} else {
+							const i32 onward{ jumps[base + flatten(next)] };
+
+							jumps[base + flatten(position)] = onward > 0 ? onward + 1 : onward - 1;
+						}
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		constexpr i32 at(offset_t position, offset_t direction) const noexcept { return jumps[direction_index(direction) * area + flatten(position)]; }
+
+		// the next jump point from position along a straight direction, or the destination should it lie on the way
+		constexpr std::optional<offset_t> jump(offset_t position, offset_t direction, offset_t destination) const noexcept {
+			const i32 entry{ at(position, direction) };
+			const i32 reach{ entry > 0 ? entry : -entry };
+
+			const offset_t delta{ destination - position };
+
+			if (direction.x != 0 && delta.y == 0 && delta.x * direction.x > 0 && delta.x * direction.x <= reach) {
+				return destination;
+			}
+
+			if (direction.y != 0 && delta.x == 0 && delta.y * direction.y > 0 && delta.y * direction.y <= reach) {
+				return destination;
+			}
+
+			if (entry > 0) {
+				return position + direction * static_cast<offset_t::scalar_t>(entry);
+			}
+
+			return std::nullopt;
+		}
+	};
+} // namespace bleak
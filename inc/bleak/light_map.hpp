@@ -0,0 +1,289 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <bleak/color.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/shadowcaster.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct light_map_t {
+		using channel_t = u16;
+
+		struct light_t {
+			offset_t position;
+			f64 radius;
+
+			// alpha scales the brightness of the light as a whole
+			color_t color;
+
+			falloff_e falloff;
+		};
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr channel_t channel_max{ 0xFF };
+
+	  private:
+		// planar channels so that blending runs over contiguous lanes
+		struct layer_t {
+			std::vector<channel_t> red;
+			std::vector<channel_t> green;
+			std::vector<channel_t> blue;
+
+			inline layer_t() noexcept : red(area, 0), green(area, 0), blue(area, 0) {}
+
+			inline void clear() noexcept {
+				std::fill(red.begin(), red.end(), channel_t{ 0 });
+				std::fill(green.begin(), green.end(), channel_t{ 0 });
+				std::fill(blue.begin(), blue.end(), channel_t{ 0 });
+			}
+		};
+
+		std::vector<light_t> static_lights;
+		std::vector<light_t> dynamic_lights;
+
+		layer_t static_layer;
+		layer_t dynamic_layer;
+
+		bool static_dirty;
+
+		color_t ambient_color;
+
+		std::vector<color_t> colors;
+
+		// the light most recently cast over each cell, so that cells revealed twice on a quadrant axis are lit once
+		std::vector<u32> stamps;
+		u32 stamp;
+
+		// brightness out of 256 by squared distance, kept until the radius or falloff changes
+		std::vector<u16> weights;
+		f64 weight_radius;
+		falloff_e weight_falloff;
+
+		shadowcaster_t caster;
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr bool reaches(cref<light_t> light, offset_t position) noexcept {
+			const i32 reach{ static_cast<i32>(light.radius) };
+
+			return std::abs(position.x - light.position.x) <= reach && std::abs(position.y - light.position.y) <= reach;
+		}
+
+		inline void weigh(f64 radius, falloff_e falloff) noexcept {
+			if (!weights.empty() && radius == weight_radius && falloff == weight_falloff) {
+				return;
+			}
+
+			weight_radius = radius;
+			weight_falloff = falloff;
+
+			weights.resize(static_cast<usize>(radius * radius) + 1);
+
+			for (usize i{ 0 }; i < weights.size(); ++i) {
+				const f64 remaining{ 1.0 - std::sqrt(static_cast<f64>(i)) / (radius + 1.0) };
+
+				f64 weight{ 1.0 };
+
+				if (falloff == falloff_e::Linear) {
+					weight = remaining;
+				} else if (falloff == falloff_e::Quadratic) {
+					weight = remaining * remaining;
+				}
+
+				weights[i] = static_cast<u16>(std::lround(std::clamp(weight, 0.0, 1.0) * 256.0));
+			}
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline void shine(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<light_t> light, ref<layer_t> layer) noexcept {
+			if (!contains(light.position) || light.radius < 0.0) {
+				return;
+			}
+
+			weigh(light.radius, light.falloff);
+
+			if (++stamp == 0) {
+				std::fill(stamps.begin(), stamps.end(), u32{ 0 });
+				stamp = 1;
+			}
+
+			const u32 red{ static_cast<u32>(light.color.r) * light.color.a / 0xFF };
+			const u32 green{ static_cast<u32>(light.color.g) * light.color.a / 0xFF };
+			const u32 blue{ static_cast<u32>(light.color.b) * light.color.a / 0xFF };
+
+			caster.cast<Size>(light.position, light.radius, [&](offset_t cell) -> bool { return zone[cell] != value; }, [&](offset_t cell) {
+				const usize index{ flatten(cell) };
+
+				if (stamps[index] == stamp) {
+					return;
+				}
+
+				stamps[index] = stamp;
+
+				const offset_t delta{ cell.x - light.position.x, cell.y - light.position.y };
+				const u32 weight{ weights[static_cast<usize>(delta.x * delta.x + delta.y * delta.y)] };
+
+				layer.red[index] = static_cast<channel_t>(std::min<u32>(layer.red[index] + (red * weight >> 8), 0xFFFF));
+				layer.green[index] = static_cast<channel_t>(std::min<u32>(layer.green[index] + (green * weight >> 8), 0xFFFF));
+				layer.blue[index] = static_cast<channel_t>(std::min<u32>(layer.blue[index] + (blue * weight >> 8), 0xFFFF));
+			});
+		}
+
+		// sums ambient, static and dynamic light per channel with saturation, reusing the dynamic layer as the sum
+		inline void compose() noexcept {
+			const channel_t ambient_red{ ambient_color.r };
+			const channel_t ambient_green{ ambient_color.g };
+			const channel_t ambient_blue{ ambient_color.b };
+
+			for (usize i{ 0 }; i < area; ++i) {
+				dynamic_layer.red[i] = static_cast<channel_t>(std::min<u32>(static_cast<u32>(ambient_red) + static_layer.red[i] + dynamic_layer.red[i], channel_max));
+			}
+
+			for (usize i{ 0 }; i < area; ++i) {
+				dynamic_layer.green[i] = static_cast<channel_t>(std::min<u32>(static_cast<u32>(ambient_green) + static_layer.green[i] + dynamic_layer.green[i], channel_max));
+			}
+
+			for (usize i{ 0 }; i < area; ++i) {
+				dynamic_layer.blue[i] = static_cast<channel_t>(std::min<u32>(static_cast<u32>(ambient_blue) + static_layer.blue[i] + dynamic_layer.blue[i], channel_max));
+			}
+
+			for (usize i{ 0 }; i < area; ++i) {
+				colors[i] = color_t{ static_cast<u8>(dynamic_layer.red[i]), static_cast<u8>(dynamic_layer.green[i]), static_cast<u8>(dynamic_layer.blue[i]), u8{ 0xFF } };
+			}
+		}
+
+	  public:
+		inline light_map_t() noexcept :
+			static_lights{},
+			dynamic_lights{},
+			static_layer{},
+			dynamic_layer{},
+			static_dirty{ false },
+			ambient_color{ u8{ 0x00 }, u8{ 0x00 }, u8{ 0x00 }, u8{ 0xFF } },
+			colors(area, color_t{ u8{ 0x00 }, u8{ 0x00 }, u8{ 0x00 }, u8{ 0xFF } }),
+			stamps(area, 0),
+			stamp{ 0 },
+			weights{},
+			weight_radius{ 0.0 },
+			weight_falloff{ falloff_e::Constant },
+			caster{} {}
+
+		inline color_t ambient() const noexcept { return ambient_color; }
+
+		inline ref<light_map_t> ambient(color_t color) noexcept {
+			ambient_color = color;
+
+			return *this;
+		}
+
+		inline usize static_count() const noexcept { return static_lights.size(); }
+
+		inline usize dynamic_count() const noexcept { return dynamic_lights.size(); }
+
+		// static lights are cast once and kept until they change or a cell they reach changes opacity
+		inline usize add_static(cref<light_t> light) noexcept {
+			static_lights.push_back(light);
+			static_dirty = true;
+
+			return static_lights.size() - 1;
+		}
+
+		inline cref<light_t> static_light(usize index) const noexcept { return static_lights[index]; }
+
+		inline ref<light_map_t> move_static(usize index, offset_t position) noexcept {
+			static_lights[index].position = position;
+			static_dirty = true;
+
+			return *this;
+		}
+
+		inline ref<light_map_t> clear_static() noexcept {
+			static_lights.clear();
+			static_dirty = true;
+
+			return *this;
+		}
+
+		// dynamic lights are recast on every illuminate
+		inline usize add_dynamic(cref<light_t> light) noexcept {
+			dynamic_lights.push_back(light);
+
+			return dynamic_lights.size() - 1;
+		}
+
+		inline ref<light_t> dynamic_light(usize index) noexcept { return dynamic_lights[index]; }
+
+		inline cref<light_t> dynamic_light(usize index) const noexcept { return dynamic_lights[index]; }
+
+		inline ref<light_map_t> clear_dynamic() noexcept {
+			dynamic_lights.clear();
+
+			return *this;
+		}
+
+		// marks a cell whose opacity changed, recasting the static lights only if one of them reaches it
+		inline ref<light_map_t> invalidate(offset_t position) noexcept {
+			if (static_dirty) {
+				return *this;
+			}
+
+			static_dirty = std::any_of(static_lights.begin(), static_lights.end(), [&](cref<light_t> light) { return reaches(light, position); });
+
+			return *this;
+		}
+
+		inline ref<light_map_t> invalidate() noexcept {
+			static_dirty = true;
+
+			return *this;
+		}
+
+		// lights the zone, where cells unequal to value block light but are themselves lit
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<light_map_t> illuminate(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			if (static_dirty) {
+				static_layer.clear();
+
+				for (crauto light : static_lights) {
+					shine(zone, value, light, static_layer);
+				}
+
+				static_dirty = false;
+			}
+
+			dynamic_layer.clear();
+
+			for (crauto light : dynamic_lights) {
+				shine(zone, value, light, dynamic_layer);
+			}
+
+			compose();
+
+			return *this;
+		}
+
+		inline color_t operator[](offset_t position) const noexcept { return colors[flatten(position)]; }
+
+		inline color_t at(offset_t position) const noexcept { return contains(position) ? colors[flatten(position)] : ambient_color; }
+
+		inline std::span<const color_t> data() const noexcept { return std::span<const color_t>{ colors.data(), colors.size() }; }
+	};
+} // namespace bleak
@@ -2,8 +2,12 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
 #include <queue>
-#include <stack>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -13,11 +17,15 @@
 #include <bleak/creeper.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/glyph.hpp>
+#include <bleak/jump_table.hpp>
 #include <bleak/line.hpp>
 #include <bleak/memory.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/path_context.hpp>
 #include <bleak/zone.hpp>
 
+#include <bleak/constants/enums.hpp>
+
 namespace bleak {
 	struct path_t {
 	  public:
@@ -38,7 +46,7 @@ namespace bleak {
 			}
 
 			if (line.start == line.end) {
-				points.push(line.start);
+				points.push_back(line.start);
 				return *this;
 			}
 
@@ -52,7 +60,7 @@ namespace bleak {
 
 			for (;;) {
 				if (pos != line.start) {
-					points.push(pos);
+					points.push_back(pos);
 				}
 
 				if (pos == line.end) {
@@ -95,7 +103,7 @@ namespace bleak {
 
 			for (;;) {
 				if (pos == line.end) {
-					points.push(pos);
+					points.push_back(pos);
 					break;
 				}
 
@@ -105,7 +113,7 @@ namespace bleak {
 				}
 
 				if (pos != line.start) {
-					points.push(pos);
+					points.push_back(pos);
 				}
 
 				i32 e2 = 2 * err;
@@ -145,7 +153,7 @@ namespace bleak {
 
 			for (;;) {
 				if (pos == line.end) {
-					points.push(pos);
+					points.push_back(pos);
 					break;
 				}
 
@@ -155,7 +163,7 @@ namespace bleak {
 				}
 				
 				if (pos != line.start) {
-					points.push(pos);
+					points.push_back(pos);
 				}
 
 				i32 e2 = 2 * err;
@@ -200,7 +208,7 @@ namespace bleak {
 
 			for (;;) {
 				if (pos == line.end) {
-					points.push(pos);
+					points.push_back(pos);
 					break;
 				}
 
@@ -210,7 +218,7 @@ namespace bleak {
 				}
 				
 				if (pos != line.start) {
-					points.push(pos);
+					points.push_back(pos);
 				}
 
 				i32 e2 = 2 * err;
@@ -256,7 +264,7 @@ namespace bleak {
 
 			for (;;) {
 				if (pos == line.end) {
-					points.push(pos);
+					points.push_back(pos);
 					break;
 				}
 
@@ -266,7 +274,7 @@ namespace bleak {
 				}
 				
 				if (pos != line.start) {
-					points.push(pos);
+					points.push_back(pos);
 				}
 
 				i32 e2 = 2 * err;
@@ -495,61 +503,159 @@ namespace bleak {
 			return *this;
 		}
 
-		inline bool empty() const { return points.empty(); }
+		template<region_e Region, distance_function_e Distance, search_e Search = search_e::AStar, dense_args>
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value, ref<path_context_t<Size>> context) {
+			if (!empty()) {
+				clear();
+			}
 
-		inline usize size() const { return points.size(); }
+			if (!is_valid<Region>(origin, destination, zone, value)) {
+				return *this;
+			}
 
-		inline offset_t top() const { return points.top(); }
+			search<Region, Distance, Search>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value); });
 
-		inline void push(offset_t point) { points.push(point); }
+			return *this;
+		}
 
-		inline void push(rval<offset_t> point) { points.push(std::move(point)); }
+		template<region_e Region, distance_function_e Distance, search_e Search = search_e::AStar, dense_args, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value, ref<path_context_t<Size>> context) {
+			if (!empty()) {
+				clear();
+			}
 
-		inline void pop() { points.pop(); }
+			if (!is_valid<Region>(origin, destination, zone, value)) {
+				return *this;
+			}
 
-		inline void emplace(offset_t::scalar_t x, offset_t::scalar_t y) { points.emplace(x, y); }
+			search<Region, Distance, Search>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value); });
 
-		inline rval<offset_t> extract() {
-			rval<offset_t> point = std::move(points.top());
-			points.pop();
-			return std::move(point);
+			return *this;
 		}
 
-		inline void clear() {
-			while (points.size() > 0) {
-				points.pop();
+		template<region_e Region, distance_function_e Distance, bool Inclusive = false, search_e Search = search_e::AStar, dense_args>
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value, cref<sparse_t> sparse_blockage, ref<path_context_t<Size>> context) {
+			if (!empty()) {
+				clear();
 			}
+
+			if constexpr (Inclusive) {
+				if (!is_valid<Region>(origin, destination, zone, value)) {
+					return *this;
+				}
+			} else {
+				if (!is_valid<Region>(origin, destination, zone, value, sparse_blockage)) {
+					return *this;
+				}
+			}
+
+			search<Region, Distance, Search>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value) && !sparse_blockage.contains(position); });
+
+			return *this;
 		}
 
-		inline void reverse() {
-			std::stack<offset_t> reversed;
+		template<region_e Region, distance_function_e Distance, bool Inclusive = false, search_e Search = search_e::AStar, dense_args, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value, cref<sparse_t> sparse_blockage, ref<path_context_t<Size>> context) {
+			if (!empty()) {
+				clear();
+			}
 
-			while (points.size() > 0) {
-				reversed.push(points.top());
-				points.pop();
+			if constexpr (Inclusive) {
+				if (!is_valid<Region>(origin, destination, zone, value)) {
+					return *this;
+				}
+			} else {
+				if (!is_valid<Region>(origin, destination, zone, value, sparse_blockage)) {
+					return *this;
+				}
 			}
 
-			std::swap(points, reversed);
+			search<Region, Distance, Search>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value) && !sparse_blockage.contains(position); });
+
+			return *this;
 		}
 
-		template<extent_t AtlasSize> inline void draw(cref<atlas_t<AtlasSize>> atlas, glyph_t glyph, offset_t offset) const {
-			if (points.empty()) {
-				return;
+		template<region_e Region, distance_function_e Distance, dense_args>
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value, ref<path_context_t<Size>> context, cref<jump_table_t<Size>> table) {
+			if (!empty()) {
+				clear();
 			}
 
-			std::stack<offset_t> copy{ points };
+			if (!is_valid<Region>(origin, destination, zone, value)) {
+				return *this;
+			}
 
-			while (copy.size() > 0) {
-				const offset_t point{ std::move(copy.top()) };
+			leap<Distance>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value); }, [&](offset_t position, offset_t direction) -> std::optional<offset_t> { return table.jump(position, direction, destination); });
 
-				atlas.draw(glyph, point + offset);
+			return *this;
+		}
 
-				copy.pop();
+		template<region_e Region, distance_function_e Distance, dense_args, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<dense_t> zone, cref<U> value, ref<path_context_t<Size>> context, cref<jump_table_t<Size>> table) {
+			if (!empty()) {
+				clear();
+			}
+
+			if (!is_valid<Region>(origin, destination, zone, value)) {
+				return *this;
+			}
+
+			leap<Distance>(origin, destination, context, [&](offset_t position) -> bool { return is_valid<Region>(position, zone, value); }, [&](offset_t position, offset_t direction) -> std::optional<offset_t> { return table.jump(position, direction, destination); });
+
+			return *this;
+		}
+
+		inline bool empty() const { return points.empty(); }
+
+		inline usize size() const { return points.size(); }
+
+		inline usize capacity() const { return points.capacity(); }
+
+		inline void reserve(usize capacity) { points.reserve(capacity); }
+
+		inline void shrink() { points.shrink_to_fit(); }
+
+		inline offset_t top() const { return points.back(); }
+
+		inline void push(cref<offset_t> point) { points.push_back(point); }
+
+		inline void push(rval<offset_t> point) { points.push_back(std::move(point)); }
+
+		inline void pop() { points.pop_back(); }
+
+		inline void emplace(offset_t::scalar_t x, offset_t::scalar_t y) { points.emplace_back(x, y); }
+
+		inline offset_t extract() {
+			const offset_t point{ points.back() };
+			points.pop_back();
+			return point;
+		}
+
+		// keeps the buffer so that the next generate can reuse it
+		inline void clear() { points.clear(); }
+
+		inline void reverse() { std::reverse(points.begin(), points.end()); }
+
+		// the remaining steps without copying, as stored and so reversed from walking order: the destination first and the next step last
+		inline std::span<const offset_t> stack() const { return std::span<const offset_t>{ points.data(), points.size() }; }
+
+		// iterates the remaining steps in walking order, from the next step through to the destination
+		inline auto begin() const { return points.crbegin(); }
+
+		inline auto end() const { return points.crend(); }
+
+		template<extent_t AtlasSize> inline void draw(cref<atlas_t<AtlasSize>> atlas, glyph_t glyph, offset_t offset) const {
+			for (cauto point : points) {
+				atlas.draw(glyph, point + offset);
 			}
 		}
 
 	  private:
-		std::stack<offset_t> points;
+		// used as a stack whose top is the next step
+		std::vector<offset_t> points;
 
 		template<region_e Region, dense_args>
 		inline bool is_valid(offset_t origin, offset_t destination, cref<dense_t> zone, cref<T> value) const {
@@ -718,13 +824,184 @@ namespace bleak {
 			return true;
 		}
 
+		template<region_e Region, distance_function_e Distance, search_e Search, extent_t Size, typename Passable>
+		inline void search(offset_t origin, offset_t destination, ref<path_context_t<Size>> context, Passable passable) noexcept {
+			if constexpr (Search == search_e::JumpPoint) {
+				cauto walkable{ [&](offset_t position) -> bool { return jump_table_t<Size>::contains(position) && (position == destination || passable(position)); } };
+
+				leap<Distance>(origin, destination, context, passable, [&](offset_t position, offset_t direction) -> std::optional<offset_t> {
+					for (offset_t next{ position + direction };; next += direction) {
+						if (!walkable(next)) {
+							return std::nullopt;
+						}
+
+						if (next == destination || jump_table_t<Size>::is_forced(next, direction, walkable)) {
+							return next;
+						}
+					}
+				});
+			} else {
+				astar<Distance>(origin, destination, context, passable);
+			}
+		}
+
+		static constexpr offset_t heading(offset_t from, offset_t to) noexcept {
+			return offset_t{ static_cast<offset_t::scalar_t>((to.x > from.x) - (to.x < from.x)), static_cast<offset_t::scalar_t>((to.y > from.y) - (to.y < from.y)) };
+		}
+
+		// jump point search; straight scans are delegated so that a precomputed jump table can stand in for the online scan
+		template<distance_function_e Distance, extent_t Size, typename Passable, typename Straight>
+		inline void leap(offset_t origin, offset_t destination, ref<path_context_t<Size>> context, Passable passable, Straight straight) noexcept {
+			static_assert(Distance == distance_function_e::Octile || Distance == distance_function_e::Euclidean, "jump point search requires an eight-way neighbourhood with diagonal cost!");
+
+			using index_t = typename path_context_t<Size>::index_t;
+
+			cauto walkable{ [&](offset_t position) -> bool { return jump_table_t<Size>::contains(position) && (position == destination || passable(position)); } };
+
+			cauto diagonal{ [&](offset_t position, offset_t direction) -> std::optional<offset_t> {
+				const offset_t horizontal{ direction.x, 0 };
+				const offset_t vertical{ 0, direction.y };
+
+				for (offset_t next{ position + direction };; next += direction) {
+					if (!walkable(next)) {
+						return std::nullopt;
+					}
+
+					if (next == destination) {
+						return next;
+					}
+
+					if ((walkable(next - horizontal + vertical) && !walkable(next - horizontal)) || (walkable(next + horizontal - vertical) && !walkable(next - vertical))) {
+						return next;
+					}
+
+					if (straight(next, horizontal) || straight(next, vertical)) {
+						return next;
+					}
+				}
+			} };
+
+			context.begin();
+
+			const index_t origin_index{ context.flatten(origin) };
+			const index_t destination_index{ context.flatten(destination) };
+
+			context.open(origin_index, 0.0f, path_context_t<Size>::no_parent, path_context_t<Size>::dependent heuristic<Distance>(origin, destination));
+
+			std::array<offset_t, 8> successors{};
+
+			for (index_t current_index{ context.settle() }; current_index != path_context_t<Size>::no_parent; current_index = context.settle()) {
+				if (current_index == destination_index) {
+					unwind_jumps(origin_index, destination_index, context);
+					return;
+				}
+
+				const offset_t current{ context.unflatten(current_index) };
+				const f32 current_cost{ context.cost(current_index) };
+
+				usize count{ 0 };
+
+				if (current_index == origin_index) {
+					for (cauto offset : neighbourhood_offsets<Distance>) {
+						successors[count++] = offset;
+					}
+				} else {
+					const offset_t direction{ heading(context.unflatten(context.parent(current_index)), current) };
+
+					if (direction.x != 0 && direction.y != 0) {
+						const offset_t horizontal{ direction.x, 0 };
+						const offset_t vertical{ 0, direction.y };
+
+						successors[count++] = horizontal;
+						successors[count++] = vertical;
+						successors[count++] = direction;
+
+						if (!walkable(current - horizontal)) {
+							successors[count++] = vertical - horizontal;
+						}
+
+						if (!walkable(current - vertical)) {
+							successors[count++] = horizontal - vertical;
+						}
+					} else {
+						const offset_t left{ direction.y, direction.x };
+						const offset_t right{ -left };
+
+						successors[count++] = direction;
+
+						if (!walkable(current + left)) {
+							successors[count++] = direction + left;
+						}
+
+						if (!walkable(current + right)) {
+							successors[count++] = direction + right;
+						}
+					}
+				}
+
+				for (usize i{ 0 }; i < count; ++i) {
+					const offset_t direction{ successors[i] };
+
+					const std::optional<offset_t> jump_point{ direction.x != 0 && direction.y != 0 ? diagonal(current, direction) : straight(current, direction) };
+
+					if (!jump_point.has_value()) {
+						continue;
+					}
+
+					const index_t jump_index{ context.flatten(*jump_point) };
+
+					if (context.is_closed(jump_index)) {
+						continue;
+					}
+
+					const offset_t span{ (*jump_point - current).abs() };
+
+					const f32 jump_cost{ current_cost + (direction.x != 0 && direction.y != 0 ? 1.414f : 1.0f) * static_cast<f32>(std::max(span.x, span.y)) };
+
+					if (context.is_open(jump_index) && jump_cost >= context.cost(jump_index)) {
+						continue;
+					}
+
+					context.open(jump_index, jump_cost, current_index, jump_cost + path_context_t<Size>::dependent heuristic<Distance>(*jump_point, destination));
+				}
+			}
+		}
+
+		template<extent_t Size> inline void unwind_jumps(typename path_context_t<Size>::index_t origin, typename path_context_t<Size>::index_t destination, cref<path_context_t<Size>> context) noexcept {
+			for (auto index{ destination }; index != origin; index = context.parent(index)) {
+				const offset_t parent{ context.unflatten(context.parent(index)) };
+
+				offset_t position{ context.unflatten(index) };
+
+				const offset_t step{ heading(position, parent) };
+
+				for (; position != parent; position += step) {
+					points.push_back(position);
+				}
+			}
+		}
+
+		// a* over the context's dense scratch; the destination is always enterable since the caller has already validated it
+		template<distance_function_e Distance, extent_t Size, typename Passable>
+		inline void astar(offset_t origin, offset_t destination, ref<path_context_t<Size>> context, Passable passable) noexcept {
+			if (context.dependent search<Distance>(origin, destination, [&](offset_t position) -> bool { return position == destination || passable(position); })) {
+				unwind(context.flatten(origin), context.flatten(destination), context);
+			}
+		}
+
+		template<extent_t Size> inline void unwind(typename path_context_t<Size>::index_t origin, typename path_context_t<Size>::index_t destination, cref<path_context_t<Size>> context) noexcept {
+			for (auto index{ destination }; index != origin; index = context.parent(index)) {
+				points.push_back(context.unflatten(index));
+			}
+		}
+
 		inline void unwind(offset_t origin, offset_t destination, cref<trail_t> trail) noexcept {
 			rememberance_t<offset_t> unwind{ trail.at(destination) };
 
-			points.push(destination);
+			points.push_back(destination);
 
 			while (unwind.current != origin) {
-				points.push(unwind.current);
+				points.push_back(unwind.current);
 				unwind = trail.at(unwind.previous);
 			}
 		}
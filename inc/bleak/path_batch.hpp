@@ -0,0 +1,153 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/path.hpp>
+#include <bleak/path_context.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct path_batch_t {
+		using sparse_t = path_t::sparse_t;
+
+		struct request_t {
+			offset_t origin;
+			offset_t destination;
+
+			cptr<sparse_t> blockage;
+		};
+
+		static constexpr extent_t size{ Size };
+
+	  private:
+		std::vector<request_t> requests;
+
+		std::vector<std::vector<offset_t>> scratch;
+
+		// one byte per request rather than a bit so that workers never share a word
+		std::vector<u8> solved;
+
+		std::vector<offset_t> points;
+		std::vector<usize> offsets;
+
+		// each worker keeps its own scratch so that requests never contend over search state
+		static inline ref<path_context_t<Size>> local_context() noexcept {
+			static thread_local path_context_t<Size> context{};
+
+			return context;
+		}
+
+		static inline ref<path_t> local_path() noexcept {
+			static thread_local path_t path{};
+
+			return path;
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		static constexpr bool is_passable(offset_t position, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cptr<sparse_t> blockage) noexcept {
+			return zone.dependent within<Region>(position) && zone[position] == value && (blockage == nullptr || !blockage->contains(position));
+		}
+
+		template<region_e Region, distance_function_e Distance, search_e Search, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline void resolve(usize index, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			cref<request_t> request{ requests[index] };
+
+			ref<path_t> path{ local_path() };
+
+			if (request.blockage != nullptr) {
+				path.dependent generate<Region, Distance, false, Search>(request.origin, request.destination, zone, value, *request.blockage, local_context());
+			} else {
+				path.dependent generate<Region, Distance, Search>(request.origin, request.destination, zone, value, local_context());
+			}
+
+			scratch[index].assign(path.begin(), path.end());
+
+			// an agent already standing on its destination has arrived, with no steps to take
+			solved[index] = !path.empty() || (request.origin == request.destination && is_passable<Region>(request.origin, zone, value, request.blockage));
+		}
+
+	  public:
+		inline path_batch_t() noexcept : requests{}, scratch{}, solved{}, points{}, offsets{ 0 } {}
+
+		inline usize count() const noexcept { return requests.size(); }
+
+		inline bool empty() const noexcept { return requests.empty(); }
+
+		inline void reserve(usize capacity) noexcept {
+			requests.reserve(capacity);
+			offsets.reserve(capacity + 1);
+		}
+
+		// drops the requests and results but keeps every buffer for the next batch
+		inline void clear() noexcept {
+			requests.clear();
+			points.clear();
+
+			offsets.clear();
+			offsets.push_back(0);
+		}
+
+		inline usize submit(offset_t origin, offset_t destination) noexcept {
+			requests.push_back(request_t{ origin, destination, nullptr });
+
+			return requests.size() - 1;
+		}
+
+		// the blockage is read during solve and must outlive it
+		inline usize submit(offset_t origin, offset_t destination, cref<sparse_t> blockage) noexcept {
+			requests.push_back(request_t{ origin, destination, &blockage });
+
+			return requests.size() - 1;
+		}
+
+		// solves every submitted request across the shared pool against a zone that must not be written to until this returns
+		template<region_e Region, distance_function_e Distance, search_e Search = search_e::AStar, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<path_batch_t> solve(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			if (scratch.size() < requests.size()) {
+				scratch.resize(requests.size());
+			}
+
+			solved.resize(requests.size());
+
+			thread_pool_t::shared().parallel_for(requests.size(), [&](usize index) { resolve<Region, Distance, Search>(index, zone, value); });
+
+			offsets.resize(requests.size() + 1);
+			offsets[0] = 0;
+
+			for (usize i{ 0 }; i < requests.size(); ++i) {
+				offsets[i + 1] = offsets[i] + scratch[i].size();
+			}
+
+			points.resize(offsets.back());
+
+			for (usize i{ 0 }; i < requests.size(); ++i) {
+				std::copy(scratch[i].begin(), scratch[i].end(), points.begin() + static_cast<isize>(offsets[i]));
+			}
+
+			return *this;
+		}
+
+		inline cref<request_t> request(usize index) const noexcept { return requests[index]; }
+
+		// the steps of a solved request from the first move through to the destination, empty if none was found or the origin is the destination
+		inline std::span<const offset_t> operator[](usize index) const noexcept { return std::span<const offset_t>{ points.data() + offsets[index], offsets[index + 1] - offsets[index] }; }
+
+		inline bool found(usize index) const noexcept { return solved[index] != 0; }
+
+		// every solved step, with the results of each request laid out back to back in submission order
+		inline std::span<const offset_t> data() const noexcept { return std::span<const offset_t>{ points.data(), points.size() }; }
+	};
+} // namespace bleak
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/hash.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/path.hpp>
+#include <bleak/path_context.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// serves the paths solved over a single zone for one walkable value type; the version only counts the edits reported to this cache, so a cache must not be shared between zones
+	template<extent_t Size, typename Value> struct path_cache_t {
+		static_assert(is_hashable<Value>::value || std::is_default_constructible<std::hash<Value>>::value, "walkable value must be hashable!");
+
+		// everything a query is solved with besides the zone itself, whose edits are tracked by the version
+		struct key_t {
+			offset_t origin;
+			offset_t destination;
+
+			region_e region;
+			distance_function_e distance;
+			search_e search;
+
+			Value value;
+
+			u64 version;
+
+			constexpr bool operator==(cref<key_t> other) const noexcept { return origin == other.origin && destination == other.destination && region == other.region && distance == other.distance && search == other.search && value == other.value && version == other.version; }
+
+			struct hasher {
+				static constexpr usize operator()(cref<key_t> key) noexcept { return hash_combine(key.origin, key.destination, key.region, key.distance, key.search, key.value, key.version); }
+			};
+		};
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+	  private:
+		struct entry_t {
+			key_t key;
+
+			// steps from the first move through to the destination
+			std::vector<offset_t> points;
+
+			bool occupied;
+		};
+
+		std::vector<entry_t> slots;
+		usize cursor;
+
+		std::unordered_map<key_t, usize, typename key_t::hasher> lookup;
+
+		// the slots of every cached path that crosses each cell
+		std::vector<std::vector<usize>> crossings;
+
+		u64 current_version;
+
+		usize hit_count;
+		usize miss_count;
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		inline void cross(offset_t position, usize slot) noexcept {
+			ref<std::vector<usize>> crossing{ crossings[flatten(position)] };
+
+			if (std::find(crossing.begin(), crossing.end(), slot) == crossing.end()) {
+				crossing.push_back(slot);
+			}
+		}
+
+		inline void uncross(offset_t position, usize slot) noexcept {
+			ref<std::vector<usize>> crossing{ crossings[flatten(position)] };
+
+			cauto iter{ std::find(crossing.begin(), crossing.end(), slot) };
+
+			if (iter != crossing.end()) {
+				*iter = crossing.back();
+				crossing.pop_back();
+			}
+		}
+
+		inline void evict(usize slot) noexcept {
+			ref<entry_t> entry{ slots[slot] };
+
+			if (!entry.occupied) {
+				return;
+			}
+
+			uncross(entry.key.origin, slot);
+
+			for (cauto point : entry.points) {
+				uncross(point, slot);
+			}
+
+			lookup.erase(entry.key);
+
+			entry.points.clear();
+			entry.occupied = false;
+		}
+
+		// slots are reused in insertion order, so a full cache drops its oldest path first
+		inline void store(cref<key_t> key, cref<path_t> path) noexcept {
+			const usize slot{ cursor };
+
+			cursor = (cursor + 1) % slots.size();
+
+			evict(slot);
+
+			ref<entry_t> entry{ slots[slot] };
+
+			entry.key = key;
+			entry.occupied = true;
+
+			entry.points.assign(path.begin(), path.end());
+
+			// the path leaves out its origin, yet an edit there invalidates it all the same
+			cross(key.origin, slot);
+
+			for (cauto point : entry.points) {
+				cross(point, slot);
+			}
+
+			lookup.emplace(key, slot);
+		}
+
+		inline void restore(usize slot, ref<path_t> path) const noexcept {
+			cref<std::vector<offset_t>> points{ slots[slot].points };
+
+			path.clear();
+			path.reserve(points.size());
+
+			for (usize i{ points.size() }; i-- > 0;) {
+				path.push(points[i]);
+			}
+		}
+
+	  public:
+		inline path_cache_t() noexcept : path_cache_t{ 256 } {}
+
+		inline explicit path_cache_t(usize capacity) noexcept :
+			slots(std::max<usize>(capacity, 1)),
+			cursor{ 0 },
+			lookup{},
+			crossings(area),
+			current_version{ 0 },
+			hit_count{ 0 },
+			miss_count{ 0 } {
+			lookup.reserve(slots.size());
+		}
+
+		inline usize capacity() const noexcept { return slots.size(); }
+
+		inline usize count() const noexcept { return lookup.size(); }
+
+		inline u64 version() const noexcept { return current_version; }
+
+		inline usize hits() const noexcept { return hit_count; }
+
+		inline usize misses() const noexcept { return miss_count; }
+
+		inline f64 hit_rate() const noexcept {
+			const usize total{ hit_count + miss_count };
+
+			return total == 0 ? 0.0 : static_cast<f64>(hit_count) / static_cast<f64>(total);
+		}
+
+		inline void reset_statistics() noexcept {
+			hit_count = 0;
+			miss_count = 0;
+		}
+
+		// serves the path from the cache when the same request was solved against the current zone version, otherwise generates and caches it
+		template<region_e Region, distance_function_e Distance, search_e Search = search_e::AStar, typename T, extent_t BorderSize>
+			requires is_equatable<T, Value>::value
+		inline ref<path_t> generate(offset_t origin, offset_t destination, cref<zone_t<T, Size, BorderSize>> zone, cref<Value> value, ref<path_context_t<Size>> context, ref<path_t> path) noexcept {
+			const key_t key{ origin, destination, Region, Distance, Search, value, current_version };
+
+			if (cauto iter{ lookup.find(key) }; iter != lookup.end()) {
+				++hit_count;
+
+				restore(iter->second, path);
+
+				return path;
+			}
+
+			++miss_count;
+
+			path.dependent generate<Region, Distance, Search>(origin, destination, zone, value, context);
+
+			if (!path.empty()) {
+				store(key, path);
+			}
+
+			return path;
+		}
+
+		// drops only the cached paths that cross an edited cell; opening a cell leaves existing paths valid if no longer the shortest
+		inline ref<path_cache_t> invalidate(offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			ref<std::vector<usize>> crossing{ crossings[flatten(position)] };
+
+			while (!crossing.empty()) {
+				evict(crossing.back());
+			}
+
+			return *this;
+		}
+
+		inline ref<path_cache_t> invalidate(cref<std::vector<offset_t>> positions) noexcept {
+			for (cauto position : positions) {
+				invalidate(position);
+			}
+
+			return *this;
+		}
+
+		// advances the zone version, retiring every cached path at once
+		inline ref<path_cache_t> invalidate() noexcept {
+			++current_version;
+
+			for (usize slot{ 0 }; slot < slots.size(); ++slot) {
+				evict(slot);
+			}
+
+			cursor = 0;
+
+			return *this;
+		}
+	};
+} // namespace bleak
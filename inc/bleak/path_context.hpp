@@ -0,0 +1,184 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <bleak/creeper.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<extent_t Size> struct path_context_t {
+		using cost_t = f32;
+		using index_t = u32;
+
+		struct node_t {
+			index_t index;
+			cost_t priority;
+
+			struct greater {
+				static constexpr bool operator()(cref<node_t> lhs, cref<node_t> rhs) noexcept { return lhs.priority > rhs.priority; }
+			};
+		};
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+		static constexpr index_t no_parent{ ~index_t{ 0 } };
+
+	  private:
+		std::vector<cost_t> costs;
+		std::vector<index_t> parents;
+
+		std::vector<u32> opened;
+		std::vector<u32> closed;
+
+		std::vector<node_t> heap;
+
+		u32 generation;
+
+	  public:
+		inline path_context_t() noexcept : costs(area), parents(area), opened(area, 0), closed(area, 0), heap{}, generation{ 0 } { heap.reserve(area / 4); }
+
+		static constexpr index_t flatten(offset_t position) noexcept { return static_cast<index_t>(position.y) * static_cast<index_t>(Size.w) + static_cast<index_t>(position.x); }
+
+		static constexpr offset_t unflatten(index_t index) noexcept { return offset_t{ static_cast<offset_t::scalar_t>(index % Size.w), static_cast<offset_t::scalar_t>(index / Size.w) }; }
+
+		// invalidates every node in constant time by advancing the generation stamp
+		constexpr void begin() noexcept {
+			heap.clear();
+
+			if (++generation == 0) {
+				std::fill(opened.begin(), opened.end(), 0);
+				std::fill(closed.begin(), closed.end(), 0);
+
+				generation = 1;
+			}
+		}
+
+		constexpr bool is_open(index_t index) const noexcept { return opened[index] == generation; }
+
+		constexpr bool is_closed(index_t index) const noexcept { return closed[index] == generation; }
+
+		constexpr cost_t cost(index_t index) const noexcept { return costs[index]; }
+
+		constexpr index_t parent(index_t index) const noexcept { return parents[index]; }
+
+		constexpr void open(index_t index, cost_t cost, index_t parent, cost_t priority) noexcept {
+			opened[index] = generation;
+			costs[index] = cost;
+			parents[index] = parent;
+
+			heap.push_back(node_t{ index, priority });
+			std::push_heap(heap.begin(), heap.end(), typename node_t::greater{});
+		}
+
+		constexpr void close(index_t index) noexcept { closed[index] = generation; }
+
+		constexpr bool empty() const noexcept { return heap.empty(); }
+
+		constexpr node_t pop() noexcept {
+			std::pop_heap(heap.begin(), heap.end(), typename node_t::greater{});
+
+			const node_t node{ heap.back() };
+			heap.pop_back();
+
+			return node;
+		}
+
+		// an admissible estimate of the cost remaining to the destination under each distance function
+		template<distance_function_e Distance> static constexpr cost_t heuristic(offset_t position, offset_t destination) noexcept {
+			const cost_t dx{ static_cast<cost_t>(std::abs(destination.x - position.x)) };
+			const cost_t dy{ static_cast<cost_t>(std::abs(destination.y - position.y)) };
+
+			if constexpr (Distance == distance_function_e::VonNeumann || Distance == distance_function_e::Manhattan) {
+				return dx + dy;
+			} else if constexpr (Distance == distance_function_e::Chebyshev) {
+				return std::max(dx, dy);
+			} else if constexpr (Distance == distance_function_e::Euclidean) {
+				return std::sqrt(dx * dx + dy * dy);
+			} else {
+				return std::max(dx, dy) + (1.414f - 1.0f) * std::min(dx, dy);
+			}
+		}
+
+		// pops until an open node turns up and closes it, or returns no_parent once the frontier runs dry
+		constexpr index_t settle() noexcept {
+			while (!heap.empty()) {
+				const index_t index{ pop().index };
+
+				if (is_closed(index)) {
+					continue;
+				}
+
+				close(index);
+
+				return index;
+			}
+
+			return no_parent;
+		}
+
+		// opens or improves every neighbour of a settled node that enterable admits, prioritised by cost plus estimate; enterable must reject positions outside the context
+		template<distance_function_e Distance, typename Enterable, typename Estimate> constexpr void expand(index_t index, Enterable enterable, Estimate estimate) noexcept {
+			const offset_t current{ unflatten(index) };
+			const cost_t current_cost{ costs[index] };
+
+			for (crauto creeper : neighbourhood_creepers<Distance, cost_t>) {
+				const offset_t neighbour{ current + creeper.position };
+
+				if (!enterable(neighbour)) {
+					continue;
+				}
+
+				const index_t neighbour_index{ flatten(neighbour) };
+
+				if (is_closed(neighbour_index)) {
+					continue;
+				}
+
+				const cost_t neighbour_cost{ current_cost + creeper.distance };
+
+				if (is_open(neighbour_index) && neighbour_cost >= costs[neighbour_index]) {
+					continue;
+				}
+
+				open(neighbour_index, neighbour_cost, index, neighbour_cost + estimate(neighbour));
+			}
+		}
+
+		// a* from origin to destination, leaving the parents for the caller to unwind; true if the destination was settled
+		template<distance_function_e Distance, typename Enterable> constexpr bool search(offset_t origin, offset_t destination, Enterable enterable) noexcept {
+			const index_t destination_index{ flatten(destination) };
+
+			begin();
+			open(flatten(origin), 0.0f, no_parent, heuristic<Distance>(origin, destination));
+
+			for (index_t index{ settle() }; index != no_parent; index = settle()) {
+				if (index == destination_index) {
+					return true;
+				}
+
+				expand<Distance>(index, enterable, [&](offset_t position) -> cost_t { return heuristic<Distance>(position, destination); });
+			}
+
+			return false;
+		}
+
+		// dijkstra from origin over every node enterable admits, leaving each settled node closed with its cost
+		template<distance_function_e Distance, typename Enterable> constexpr void flood(offset_t origin, Enterable enterable) noexcept {
+			begin();
+			open(flatten(origin), 0.0f, no_parent, 0.0f);
+
+			for (index_t index{ settle() }; index != no_parent; index = settle()) {
+				expand<Distance>(index, enterable, [](offset_t) -> cost_t { return 0.0f; });
+			}
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bleak/clock.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/path.hpp>
+#include <bleak/path_context.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<extent_t Size, distance_function_e Distance> struct path_search_t {
+		using context_type = path_context_t<Size>;
+		using index_t = typename context_type::index_t;
+		using sparse_t = path_t::sparse_t;
+
+		static constexpr extent_t size{ Size };
+
+		// how many expansions pass between clock reads when stepping against a time budget
+		static constexpr usize clock_stride{ 64 };
+
+	  private:
+		context_type context;
+
+		offset_t origin;
+		offset_t destination;
+
+		index_t origin_index;
+		index_t destination_index;
+
+		index_t closest_index;
+		f32 closest_estimate;
+		f32 initial_estimate;
+
+		usize expanded;
+
+		search_status_e state;
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		// expands nodes until the search settles or proceed, given the expansions made so far in this call, declines to continue
+		template<typename Passable, typename Proceed> inline search_status_e advance(Passable passable, Proceed proceed) noexcept {
+			if (state != search_status_e::Searching) {
+				return state;
+			}
+
+			for (usize step{ 0 }; proceed(step); ++step) {
+				const index_t current_index{ context.settle() };
+
+				if (current_index == context_type::no_parent) {
+					return state = search_status_e::Exhausted;
+				}
+
+				++expanded;
+
+				if (const f32 estimate{ context_type::dependent heuristic<Distance>(context.unflatten(current_index), destination) }; estimate < closest_estimate) {
+					closest_index = current_index;
+					closest_estimate = estimate;
+				}
+
+				if (current_index == destination_index) {
+					return state = search_status_e::Found;
+				}
+
+				context.dependent expand<Distance>(current_index, [&](offset_t position) -> bool { return contains(position) && (position == destination || passable(position)); }, [&](offset_t position) -> f32 { return context_type::dependent heuristic<Distance>(position, destination); });
+			}
+
+			return state;
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		static constexpr bool is_passable(offset_t position, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			return zone.dependent within<Region>(position) && zone[position] == value;
+		}
+
+		inline void unwind(index_t index, ref<path_t> path) const noexcept {
+			path.clear();
+
+			for (; index != origin_index; index = context.parent(index)) {
+				path.push(context.unflatten(index));
+			}
+		}
+
+		template<typename Passable> inline search_status_e budget(Passable passable, f64 milliseconds) noexcept {
+			const usize deadline{ Clock::now() + static_cast<usize>(milliseconds * static_cast<f64>(Clock::frequency()) / 1000.0) };
+
+			return advance(passable, [&](usize step) -> bool { return step % clock_stride != 0 || step == 0 || Clock::now() < deadline; });
+		}
+
+	  public:
+		inline path_search_t() noexcept :
+			context{},
+			origin{},
+			destination{},
+			origin_index{ 0 },
+			destination_index{ 0 },
+			closest_index{ 0 },
+			closest_estimate{ 0.0f },
+			initial_estimate{ 0.0f },
+			expanded{ 0 },
+			state{ search_status_e::Idle } {}
+
+		inline search_status_e status() const noexcept { return state; }
+
+		inline bool searching() const noexcept { return state == search_status_e::Searching; }
+
+		inline bool done() const noexcept { return state == search_status_e::Found || state == search_status_e::Exhausted; }
+
+		inline bool found() const noexcept { return state == search_status_e::Found; }
+
+		inline usize expansions() const noexcept { return expanded; }
+
+		// how much of the straight-line distance the closest node reached so far has covered, from zero to one
+		inline f32 progress() const noexcept {
+			if (state == search_status_e::Found) {
+				return 1.0f;
+			}
+
+			if (initial_estimate <= 0.0f) {
+				return 0.0f;
+			}
+
+			return 1.0f - closest_estimate / initial_estimate;
+		}
+
+		// starts a new search, abandoning any in flight; the zone must not change while it is being stepped
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline search_status_e begin(offset_t origin, offset_t destination, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			this->origin = origin;
+			this->destination = destination;
+
+			expanded = 0;
+
+			origin_index = closest_index = 0;
+
+			if (!contains(origin) || !contains(destination) || !is_passable<Region>(origin, zone, value) || !is_passable<Region>(destination, zone, value)) {
+				return state = search_status_e::Exhausted;
+			}
+
+			origin_index = context.flatten(origin);
+			destination_index = context.flatten(destination);
+
+			closest_index = origin_index;
+			closest_estimate = initial_estimate = context_type::dependent heuristic<Distance>(origin, destination);
+
+			// already standing on the destination: found, with nothing to walk
+			if (origin == destination) {
+				return state = search_status_e::Found;
+			}
+
+			context.begin();
+			context.open(origin_index, 0.0f, context_type::no_parent, initial_estimate);
+
+			return state = search_status_e::Searching;
+		}
+
+		inline void cancel() noexcept { state = search_status_e::Idle; }
+
+		// expands at most the given number of nodes
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline search_status_e step(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, usize nodes) noexcept {
+			return advance([&](offset_t position) -> bool { return is_passable<Region>(position, zone, value); }, [&](usize step) -> bool { return step < nodes; });
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline search_status_e step(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<sparse_t> sparse_blockage, usize nodes) noexcept {
+			return advance([&](offset_t position) -> bool { return is_passable<Region>(position, zone, value) && !sparse_blockage.contains(position); }, [&](usize step) -> bool { return step < nodes; });
+		}
+
+		// expands nodes until roughly the given number of milliseconds have passed
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline search_status_e step_for(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, f64 milliseconds) noexcept {
+			return budget([&](offset_t position) -> bool { return is_passable<Region>(position, zone, value); }, milliseconds);
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline search_status_e step_for(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, cref<sparse_t> sparse_blockage, f64 milliseconds) noexcept {
+			return budget([&](offset_t position) -> bool { return is_passable<Region>(position, zone, value) && !sparse_blockage.contains(position); }, milliseconds);
+		}
+
+		// the finished path, or an empty one if the search has not found the destination
+		inline bool result(ref<path_t> path) const noexcept {
+			if (state != search_status_e::Found) {
+				path.clear();
+
+				return false;
+			}
+
+			unwind(destination_index, path);
+
+			return true;
+		}
+
+		// the path to the node nearest the destination expanded so far, for agents that should start moving before the search completes
+		inline bool partial(ref<path_t> path) const noexcept {
+			if (state == search_status_e::Idle || closest_index == origin_index) {
+				path.clear();
+
+				return false;
+			}
+
+			unwind(closest_index, path);
+
+			return true;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,683 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/path.hpp>
+#include <bleak/path_context.hpp>
+#include <bleak/region.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	template<typename T, extent_t RegionSize, extent_t ZoneSize, extent_t ZoneBorder, distance_function_e Distance> struct region_graph_t {
+		using region_type = region_t<T, RegionSize, ZoneSize, ZoneBorder>;
+		using context_type = path_context_t<ZoneSize>;
+
+		using index_t = u32;
+		using cost_t = f32;
+
+		struct transition_t {
+			offset_t from;
+			offset_t to;
+			cost_t cost;
+
+			constexpr bool operator==(cref<transition_t> other) const noexcept { return from == other.from && to == other.to && cost == other.cost; }
+		};
+
+		// a crossing from one of a zone's entrance slots to a slot of a neighbouring zone
+		struct link_t {
+			index_t from;
+			index_t zone;
+			index_t to;
+			cost_t cost;
+		};
+
+		static constexpr extent_t region_size{ RegionSize };
+		static constexpr extent_t zone_size{ ZoneSize };
+
+		static constexpr extent_t size{ RegionSize * ZoneSize };
+
+		static constexpr usize region_area{ static_cast<usize>(RegionSize.area()) };
+
+		static constexpr bool is_diagonal{ Distance != distance_function_e::VonNeumann && Distance != distance_function_e::Manhattan };
+
+		static constexpr cost_t straight_cost{ 1.0f };
+		static constexpr cost_t diagonal_cost{ Distance == distance_function_e::Chebyshev ? 1.0f : 1.414f };
+
+		static constexpr cost_t unreachable{ std::numeric_limits<cost_t>::infinity() };
+
+		static constexpr index_t no_node{ ~index_t{ 0 } };
+
+		// entrances wider than this are given a transition at either end rather than one in the middle
+		static constexpr extent_t::scalar_t entrance_split{ 6 };
+
+		// each zone owns the seams along its east and south edges and across its south-eastern and south-western corners
+		enum struct seam_e : u8 { East, South, Southeast, Southwest };
+
+		static constexpr usize seam_count{ 4 };
+
+	  private:
+		std::vector<std::vector<transition_t>> seams;
+
+		std::vector<std::vector<offset_t>> entrances;
+		std::vector<std::vector<cost_t>> costs;
+
+		std::vector<bool> dirty;
+
+		std::vector<index_t> bases;
+
+		// kept per zone and addressed by slot rather than node so that an edit only relinks the zones around it
+		std::vector<std::vector<link_t>> links;
+
+		std::vector<cost_t> origin_costs;
+		std::vector<cost_t> destination_costs;
+
+		std::vector<cost_t> scores;
+		std::vector<index_t> parents;
+		std::vector<bool> closed;
+
+		using node_t = std::pair<cost_t, index_t>;
+
+		std::vector<node_t> frontier;
+
+		std::vector<offset_t> waypoints;
+
+		context_type context;
+
+		bool stale;
+
+		static constexpr usize zone_index(offset_t zone_position) noexcept { return static_cast<usize>(zone_position.y) * static_cast<usize>(RegionSize.w) + static_cast<usize>(zone_position.x); }
+
+		static constexpr offset_t zone_position(usize index) noexcept { return offset_t{ static_cast<offset_t::scalar_t>(index % RegionSize.w), static_cast<offset_t::scalar_t>(index / RegionSize.w) }; }
+
+		static constexpr offset_t zone_origin(offset_t zone_position) noexcept { return zone_position * ZoneSize; }
+
+		static constexpr bool contains_zone(offset_t zone_position) noexcept { return zone_position.x >= 0 && zone_position.y >= 0 && zone_position.x < RegionSize.w && zone_position.y < RegionSize.h; }
+
+		static constexpr bool contains_cell(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < ZoneSize.w && position.y < ZoneSize.h; }
+
+		template<typename U> static constexpr bool is_passable(offset_t position, cref<region_type> region, cref<U> value) noexcept {
+			if (!contains(position)) {
+				return false;
+			}
+
+			return region[position / ZoneSize, position % ZoneSize] == value;
+		}
+
+		template<typename U> static constexpr void connect(ref<std::vector<transition_t>> seam, offset_t start, offset_t across, offset_t along, extent_t::scalar_t count, cref<region_type> region, cref<U> value) noexcept {
+			cauto crossable{ [&](extent_t::scalar_t i) -> bool { return is_passable(start + along * i, region, value) && is_passable(start + along * i + across, region, value); } };
+
+			for (extent_t::scalar_t i{ 0 }; i < count;) {
+				if (!crossable(i)) {
+					if constexpr (is_diagonal) {
+						if (i + 1 < count && !crossable(i + 1)) {
+							const offset_t near{ start + along * i };
+							const offset_t far{ near + along };
+
+							if (is_passable(near, region, value) && is_passable(far + across, region, value)) {
+								seam.push_back(transition_t{ near, far + across, diagonal_cost });
+							}
+
+							if (is_passable(far, region, value) && is_passable(near + across, region, value)) {
+								seam.push_back(transition_t{ far, near + across, diagonal_cost });
+							}
+						}
+					}
+
+					++i;
+
+					continue;
+				}
+
+				const extent_t::scalar_t first{ i };
+
+				while (i < count && crossable(i)) {
+					++i;
+				}
+
+				const extent_t::scalar_t last{ static_cast<extent_t::scalar_t>(i - 1) };
+
+				if (last - first + 1 >= entrance_split) {
+					seam.push_back(transition_t{ start + along * first, start + along * first + across, straight_cost });
+					seam.push_back(transition_t{ start + along * last, start + along * last + across, straight_cost });
+				} else {
+					const extent_t::scalar_t middle{ static_cast<extent_t::scalar_t>((first + last) / 2) };
+
+					seam.push_back(transition_t{ start + along * middle, start + along * middle + across, straight_cost });
+				}
+			}
+		}
+
+		// corners only need a transition when both cells flanking the diagonal are blocked, otherwise an edge seam already covers the crossing
+		template<typename U> static constexpr void connect(ref<std::vector<transition_t>> seam, offset_t corner, offset_t across, cref<region_type> region, cref<U> value) noexcept {
+			if (!is_passable(corner, region, value) || !is_passable(corner + across, region, value)) {
+				return;
+			}
+
+			if (is_passable(corner + offset_t{ across.x, 0 }, region, value) || is_passable(corner + offset_t{ 0, across.y }, region, value)) {
+				return;
+			}
+
+			seam.push_back(transition_t{ corner, corner + across, diagonal_cost });
+		}
+
+		template<typename U> constexpr bool stitch(usize zone, seam_e seam, cref<region_type> region, cref<U> value) noexcept {
+			const offset_t position{ zone_position(zone) };
+			const offset_t origin{ zone_origin(position) };
+
+			std::vector<transition_t> transitions{};
+
+			switch (seam) {
+				case seam_e::East: {
+					if (contains_zone(position + offset_t::East)) {
+						connect(transitions, origin + offset_t{ static_cast<offset_t::scalar_t>(ZoneSize.w - 1), 0 }, offset_t::East, offset_t::South, ZoneSize.h, region, value);
+					}
+					break;
+				}
+				case seam_e::South: {
+					if (contains_zone(position + offset_t::South)) {
+						connect(transitions, origin + offset_t{ 0, static_cast<offset_t::scalar_t>(ZoneSize.h - 1) }, offset_t::South, offset_t::East, ZoneSize.w, region, value);
+					}
+					break;
+				}
+				case seam_e::Southeast: {
+					if constexpr (is_diagonal) {
+						if (contains_zone(position + offset_t::Southeast)) {
+							connect(transitions, origin + ZoneSize - 1, offset_t::Southeast, region, value);
+						}
+					}
+					break;
+				}
+				case seam_e::Southwest: {
+					if constexpr (is_diagonal) {
+						if (contains_zone(position + offset_t::Southwest)) {
+							connect(transitions, origin + offset_t{ 0, static_cast<offset_t::scalar_t>(ZoneSize.h - 1) }, offset_t::Southwest, region, value);
+						}
+					}
+					break;
+				}
+			}
+
+			ref<std::vector<transition_t>> current{ seams[zone * seam_count + static_cast<usize>(seam)] };
+
+			if (current == transitions) {
+				return false;
+			}
+
+			current.swap(transitions);
+
+			return true;
+		}
+
+		template<typename Func> constexpr void each_seam(usize zone, Func func) const noexcept {
+			const offset_t position{ zone_position(zone) };
+
+			func(zone, seam_e::East);
+			func(zone, seam_e::South);
+			func(zone, seam_e::Southeast);
+			func(zone, seam_e::Southwest);
+
+			if (contains_zone(position + offset_t::West)) {
+				func(zone_index(position + offset_t::West), seam_e::East);
+			}
+
+			if (contains_zone(position + offset_t::North)) {
+				func(zone_index(position + offset_t::North), seam_e::South);
+			}
+
+			if (contains_zone(position + offset_t::Northwest)) {
+				func(zone_index(position + offset_t::Northwest), seam_e::Southeast);
+			}
+
+			if (contains_zone(position + offset_t::Northeast)) {
+				func(zone_index(position + offset_t::Northeast), seam_e::Southwest);
+			}
+		}
+
+		// corner seams also depend on the cells flanking their diagonal, which lie in the zones beside and below the owner
+		template<typename Func> constexpr void each_flank(usize zone, Func func) const noexcept {
+			const offset_t position{ zone_position(zone) };
+
+			if (contains_zone(position + offset_t::West)) {
+				func(zone_index(position + offset_t::West), seam_e::Southeast);
+			}
+
+			if (contains_zone(position + offset_t::East)) {
+				func(zone_index(position + offset_t::East), seam_e::Southwest);
+			}
+
+			if (contains_zone(position + offset_t::North)) {
+				func(zone_index(position + offset_t::North), seam_e::Southeast);
+				func(zone_index(position + offset_t::North), seam_e::Southwest);
+			}
+		}
+
+		// dijkstra within a single zone from a local origin; the context is left holding the settled costs
+		template<typename U> constexpr void flood(usize zone, offset_t origin, cref<region_type> region, cref<U> value) noexcept {
+			cref<typename region_type::zone_type> cells{ region[zone_position(zone)] };
+
+			context.dependent flood<Distance>(origin, [&](offset_t position) -> bool { return contains_cell(position) && cells[position] == value; });
+		}
+
+		constexpr cost_t settled(offset_t position) const noexcept {
+			const index_t index{ context.flatten(position) };
+
+			return context.is_closed(index) ? context.cost(index) : unreachable;
+		}
+
+		constexpr void gather(usize zone) noexcept {
+			const offset_t origin{ zone_origin(zone_position(zone)) };
+
+			ref<std::vector<offset_t>> cells{ entrances[zone] };
+
+			cells.clear();
+
+			cauto include{ [&](offset_t position) {
+				if (position / ZoneSize != zone_position(zone)) {
+					return;
+				}
+
+				const offset_t local{ position - origin };
+
+				if (std::find(cells.begin(), cells.end(), local) == cells.end()) {
+					cells.push_back(local);
+				}
+			} };
+
+			each_seam(zone, [&](usize owner, seam_e seam) {
+				for (crauto transition : seams[owner * seam_count + static_cast<usize>(seam)]) {
+					include(transition.from);
+					include(transition.to);
+				}
+			});
+		}
+
+		template<typename U> constexpr void measure(usize zone, cref<region_type> region, cref<U> value) noexcept {
+			cref<std::vector<offset_t>> cells{ entrances[zone] };
+
+			const usize count{ cells.size() };
+
+			ref<std::vector<cost_t>> matrix{ costs[zone] };
+
+			matrix.assign(count * count, unreachable);
+
+			for (usize i{ 0 }; i < count; ++i) {
+				flood(zone, cells[i], region, value);
+
+				for (usize j{ 0 }; j < count; ++j) {
+					matrix[i * count + j] = settled(cells[j]);
+				}
+			}
+		}
+
+		constexpr index_t slot_of(usize zone, offset_t position) const noexcept {
+			const offset_t local{ position - zone_origin(zone_position(zone)) };
+
+			cref<std::vector<offset_t>> cells{ entrances[zone] };
+
+			for (usize i{ 0 }; i < cells.size(); ++i) {
+				if (cells[i] == local) {
+					return static_cast<index_t>(i);
+				}
+			}
+
+			return no_node;
+		}
+
+		constexpr void rebase() noexcept {
+			index_t total{ 0 };
+
+			for (usize zone{ 0 }; zone < region_area; ++zone) {
+				bases[zone] = total;
+				total += static_cast<index_t>(entrances[zone].size());
+			}
+
+			bases[region_area] = total;
+		}
+
+		// collects the crossings out of a zone from the seams around it, resolving both ends to slots
+		constexpr void link(usize zone) noexcept {
+			const offset_t position{ zone_position(zone) };
+
+			ref<std::vector<link_t>> crossings{ links[zone] };
+
+			crossings.clear();
+
+			each_seam(zone, [&](usize owner, seam_e seam) {
+				for (crauto transition : seams[owner * seam_count + static_cast<usize>(seam)]) {
+					const bool outward{ transition.from / ZoneSize == position };
+
+					const offset_t near{ outward ? transition.from : transition.to };
+					const offset_t far{ outward ? transition.to : transition.from };
+
+					const usize other{ zone_index(far / ZoneSize) };
+
+					crossings.push_back(link_t{ slot_of(zone, near), static_cast<index_t>(other), slot_of(other, far), transition.cost });
+				}
+			});
+		}
+
+		constexpr usize node_zone(index_t node) const noexcept { return static_cast<usize>(std::upper_bound(bases.begin(), bases.end(), node) - bases.begin()) - 1; }
+
+		constexpr offset_t node_position(usize zone, index_t slot) const noexcept { return entrances[zone][slot] + zone_origin(zone_position(zone)); }
+
+		constexpr offset_t node_position(index_t node) const noexcept {
+			const usize zone{ node_zone(node) };
+
+			return node_position(zone, node - bases[zone]);
+		}
+
+		// a* from a local origin to a local destination within one zone, pushed onto the path destination first
+		template<typename U> constexpr bool trace(usize zone, offset_t origin, offset_t destination, cref<region_type> region, cref<U> value, ref<path_t> path) noexcept {
+			cref<typename region_type::zone_type> cells{ region[zone_position(zone)] };
+
+			if (!context.dependent search<Distance>(origin, destination, [&](offset_t position) -> bool { return contains_cell(position) && cells[position] == value; })) {
+				return false;
+			}
+
+			const offset_t offset{ zone_origin(zone_position(zone)) };
+
+			const index_t origin_index{ context.flatten(origin) };
+
+			for (index_t index{ context.flatten(destination) }; index != origin_index; index = context.parent(index)) {
+				path.push(context.unflatten(index) + offset);
+			}
+
+			return true;
+		}
+
+		// pushes the concrete steps from one waypoint to the next, excluding the former
+		template<typename U> constexpr bool extend(offset_t from, offset_t to, cref<region_type> region, cref<U> value, ref<path_t> path) noexcept {
+			const offset_t from_zone{ from / ZoneSize };
+
+			if (from_zone != to / ZoneSize) {
+				path.push(to);
+
+				return true;
+			}
+
+			const offset_t origin{ zone_origin(from_zone) };
+
+			return trace(zone_index(from_zone), from - origin, to - origin, region, value, path);
+		}
+
+	  public:
+		inline region_graph_t() noexcept :
+			seams(region_area * seam_count),
+			entrances(region_area),
+			costs(region_area),
+			dirty(region_area, true),
+			bases(region_area + 1, 0),
+			links(region_area),
+			origin_costs{},
+			destination_costs{},
+			scores{},
+			parents{},
+			closed{},
+			frontier{},
+			waypoints{},
+			context{},
+			stale{ true } {}
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < size.w && position.y < size.h; }
+
+		constexpr usize node_count() const noexcept { return bases[region_area]; }
+
+		constexpr cref<std::vector<offset_t>> entrances_of(offset_t zone_position) const noexcept { return entrances[zone_index(zone_position)]; }
+
+		// marks a zone whose cells have changed; its seams and cached costs, and those of any neighbour whose entrances move, are rebuilt on the next refresh
+		constexpr ref<region_graph_t> invalidate(offset_t zone_position) noexcept {
+			if (contains_zone(zone_position)) {
+				dirty[zone_index(zone_position)] = true;
+				stale = true;
+			}
+
+			return *this;
+		}
+
+		constexpr ref<region_graph_t> invalidate(cref<region_offset_t> position) noexcept { return invalidate(position.zone); }
+
+		constexpr ref<region_graph_t> invalidate() noexcept {
+			std::fill(dirty.begin(), dirty.end(), true);
+			stale = true;
+
+			return *this;
+		}
+
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<region_graph_t> refresh(cref<region_type> region, cref<U> value) noexcept {
+			if (!stale) {
+				return *this;
+			}
+
+			std::vector<bool> touched{ dirty };
+
+			for (usize zone{ 0 }; zone < region_area; ++zone) {
+				if (!dirty[zone]) {
+					continue;
+				}
+
+				cauto restitch{ [&](usize owner, seam_e seam) {
+					if (!stitch(owner, seam, region, value)) {
+						return;
+					}
+
+					const offset_t position{ zone_position(owner) };
+
+					touched[owner] = true;
+
+					switch (seam) {
+						case seam_e::East: {
+							touched[zone_index(position + offset_t::East)] = true;
+							break;
+						}
+						case seam_e::South: {
+							touched[zone_index(position + offset_t::South)] = true;
+							break;
+						}
+						case seam_e::Southeast: {
+							touched[zone_index(position + offset_t::Southeast)] = true;
+							break;
+						}
+						case seam_e::Southwest: {
+							touched[zone_index(position + offset_t::Southwest)] = true;
+							break;
+						}
+					}
+				} };
+
+				each_seam(zone, restitch);
+				each_flank(zone, restitch);
+			}
+
+			std::vector<bool> relink{ touched };
+
+			for (usize zone{ 0 }; zone < region_area; ++zone) {
+				if (!touched[zone]) {
+					continue;
+				}
+
+				const std::vector<offset_t> previous{ entrances[zone] };
+
+				gather(zone);
+
+				if (previous != entrances[zone]) {
+					// the slots its neighbours' crossings point at have been renumbered
+					for (crauto offset : neighbourhood_offsets<Distance>) {
+						if (contains_zone(zone_position(zone) + offset)) {
+							relink[zone_index(zone_position(zone) + offset)] = true;
+						}
+					}
+				}
+
+				if (dirty[zone] || previous != entrances[zone]) {
+					measure(zone, region, value);
+				}
+			}
+
+			rebase();
+
+			for (usize zone{ 0 }; zone < region_area; ++zone) {
+				if (relink[zone]) {
+					link(zone);
+				}
+			}
+
+			std::fill(dirty.begin(), dirty.end(), false);
+			stale = false;
+
+			return *this;
+		}
+
+		// abstract search across the entrance graph; the waypoints run from the first entrance to the destination, excluding the origin
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool route(offset_t origin, offset_t destination, cref<region_type> region, cref<U> value, ref<std::vector<offset_t>> steps) noexcept {
+			steps.clear();
+
+			if (!is_passable(origin, region, value) || !is_passable(destination, region, value) || origin == destination) {
+				return false;
+			}
+
+			refresh(region, value);
+
+			const offset_t origin_zone{ origin / ZoneSize };
+			const offset_t destination_zone{ destination / ZoneSize };
+
+			const usize origin_index{ zone_index(origin_zone) };
+			const usize destination_index{ zone_index(destination_zone) };
+
+			const index_t total{ bases[region_area] };
+			const index_t goal{ total };
+
+			scores.assign(total + 1, unreachable);
+			parents.assign(total + 1, no_node);
+			closed.assign(total + 1, false);
+
+			frontier.clear();
+
+			cauto relax{ [&](index_t node, offset_t position, cost_t cost, index_t parent) {
+				if (cost >= scores[node]) {
+					return;
+				}
+
+				scores[node] = cost;
+				parents[node] = parent;
+
+				frontier.emplace_back(cost + context_type::dependent heuristic<Distance>(position, destination), node);
+				std::push_heap(frontier.begin(), frontier.end(), std::greater<node_t>{});
+			} };
+
+			flood(origin_index, origin - zone_origin(origin_zone), region, value);
+
+			origin_costs.resize(entrances[origin_index].size());
+
+			for (usize i{ 0 }; i < origin_costs.size(); ++i) {
+				origin_costs[i] = settled(entrances[origin_index][i]);
+			}
+
+			if (origin_index == destination_index) {
+				relax(goal, destination, settled(destination - zone_origin(destination_zone)), no_node);
+			}
+
+			flood(destination_index, destination - zone_origin(destination_zone), region, value);
+
+			destination_costs.resize(entrances[destination_index].size());
+
+			for (usize i{ 0 }; i < destination_costs.size(); ++i) {
+				destination_costs[i] = settled(entrances[destination_index][i]);
+			}
+
+			for (usize i{ 0 }; i < origin_costs.size(); ++i) {
+				relax(bases[origin_index] + static_cast<index_t>(i), node_position(origin_index, static_cast<index_t>(i)), origin_costs[i], no_node);
+			}
+
+			while (!frontier.empty()) {
+				std::pop_heap(frontier.begin(), frontier.end(), std::greater<node_t>{});
+
+				const index_t current{ frontier.back().second };
+				frontier.pop_back();
+
+				if (closed[current]) {
+					continue;
+				}
+
+				closed[current] = true;
+
+				if (current == goal) {
+					for (index_t node{ goal }; node != no_node; node = parents[node]) {
+						steps.push_back(node == goal ? destination : node_position(node));
+					}
+
+					std::reverse(steps.begin(), steps.end());
+
+					return true;
+				}
+
+				const usize zone{ node_zone(current) };
+				const usize slot{ current - bases[zone] };
+				const usize count{ entrances[zone].size() };
+
+				for (usize j{ 0 }; j < count; ++j) {
+					const cost_t cost{ costs[zone][slot * count + j] };
+
+					if (j != slot && cost != unreachable) {
+						relax(bases[zone] + static_cast<index_t>(j), node_position(zone, static_cast<index_t>(j)), scores[current] + cost, current);
+					}
+				}
+
+				if (zone == destination_index && destination_costs[slot] != unreachable) {
+					relax(goal, destination, scores[current] + destination_costs[slot], current);
+				}
+
+				for (crauto crossing : links[zone]) {
+					if (crossing.from == slot) {
+						relax(bases[crossing.zone] + crossing.to, node_position(crossing.zone, crossing.to), scores[current] + crossing.cost, current);
+					}
+				}
+			}
+
+			return false;
+		}
+
+		// refines a single leg of a route into concrete steps, for callers that walk the route lazily
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool refine(offset_t from, offset_t to, cref<region_type> region, cref<U> value, ref<path_t> path) noexcept {
+			path.clear();
+
+			return extend(from, to, region, value, path);
+		}
+
+		// routes and refines every leg up front, leaving the first step on top of the path
+		template<typename U>
+			requires is_equatable<T, U>::value
+		constexpr bool generate(offset_t origin, offset_t destination, cref<region_type> region, cref<U> value, ref<path_t> path) noexcept {
+			path.clear();
+
+			if (!route(origin, destination, region, value, waypoints)) {
+				return false;
+			}
+
+			for (usize i{ waypoints.size() }; i-- > 0;) {
+				if (!extend(i > 0 ? waypoints[i - 1] : origin, waypoints[i], region, value, path)) {
+					path.clear();
+
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+} // namespace bleak
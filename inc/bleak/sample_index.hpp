@@ -0,0 +1,284 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/random.hpp>
+#include <bleak/zone.hpp>
+
+#include <bleak/constants/enums.hpp>
+
+namespace bleak {
+	// fenwick tree over the cells that match and are not blocked, drawing one uniformly by rank in logarithmic time
+	template<extent_t Size> struct sample_index_t {
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+	  private:
+		// one based; unsigned sums wrap on removal but every prefix is still exact
+		std::vector<u32> tree;
+
+		std::vector<u8> matches;
+		std::vector<u8> blocks;
+
+		usize total;
+
+		// scratch for cells withdrawn while rejecting against transient blockages
+		std::vector<usize> withdrawn;
+
+		static constexpr usize top{ std::bit_floor(area) };
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr offset_t unflatten(usize index) noexcept { return offset_t{ static_cast<i32>(index % static_cast<usize>(Size.w)), static_cast<i32>(index / static_cast<usize>(Size.w)) }; }
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		constexpr bool eligible(usize index) const noexcept { return matches[index] != 0 && blocks[index] == 0; }
+
+		constexpr void add(usize index, u32 delta) noexcept {
+			for (usize i{ index + 1 }; i <= area; i += i & (~i + 1)) {
+				tree[i] += delta;
+			}
+		}
+
+		constexpr void include(usize index) noexcept {
+			add(index, 1);
+			++total;
+		}
+
+		constexpr void exclude(usize index) noexcept {
+			add(index, static_cast<u32>(-1));
+			--total;
+		}
+
+		// the index of the eligible cell with the given zero based rank, found by descending the tree
+		constexpr usize select(usize rank) const noexcept {
+			usize position{ 0 };
+
+			for (usize step{ top }; step > 0; step >>= 1) {
+				const usize next{ position + step };
+
+				if (next <= area && tree[next] <= rank) {
+					position = next;
+					rank -= tree[next];
+				}
+			}
+
+			return position;
+		}
+
+		template<RandomEngine Randomizer> constexpr usize draw(ref<Randomizer> generator) const noexcept {
+			std::uniform_int_distribution<usize> dis{ 0, total - 1 };
+
+			return select(dis(generator));
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename Predicate> inline void tabulate(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			std::fill(tree.begin(), tree.end(), u32{ 0 });
+
+			total = 0;
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					const offset_t position{ x, y };
+					const usize index{ flatten(position) };
+
+					matches[index] = zone.template within<Region>(position) && predicate(zone[position]) ? 1 : 0;
+
+					if (eligible(index)) {
+						tree[index + 1] = 1;
+						++total;
+					}
+				}
+			}
+
+			// pushes each node into its parent once rather than a point update per cell
+			for (usize i{ 1 }; i <= area; ++i) {
+				const usize parent{ i + (i & (~i + 1)) };
+
+				if (parent <= area) {
+					tree[parent] += tree[i];
+				}
+			}
+		}
+
+	  public:
+		inline sample_index_t() noexcept : tree(area + 1, 0), matches(area, 0), blocks(area, 0), total{ 0 }, withdrawn{} {}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<sample_index_t> build(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			tabulate<Region>(zone, [&](cref<T> cell) -> bool { return cell == value; });
+
+			return *this;
+		}
+
+		template<region_e Region, typename T, extent_t BorderSize, typename Predicate> inline ref<sample_index_t> build_if(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			tabulate<Region>(zone, predicate);
+
+			return *this;
+		}
+
+		// how many cells match and are not blocked
+		inline usize count() const noexcept { return total; }
+
+		inline bool empty() const noexcept { return total == 0; }
+
+		inline bool operator[](offset_t position) const noexcept { return eligible(flatten(position)); }
+
+		inline bool matches_at(offset_t position) const noexcept { return contains(position) && matches[flatten(position)] != 0; }
+
+		inline bool blocked(offset_t position) const noexcept { return contains(position) && blocks[flatten(position)] != 0; }
+
+		// records whether a cell now matches; repeated calls with the same state are no-ops
+		inline ref<sample_index_t> set(offset_t position, bool match) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			const usize index{ flatten(position) };
+
+			if (static_cast<bool>(matches[index]) == match) {
+				return *this;
+			}
+
+			const bool was{ eligible(index) };
+
+			matches[index] = match ? 1 : 0;
+
+			if (was && !eligible(index)) {
+				exclude(index);
+			} else if (!was && eligible(index)) {
+				include(index);
+			}
+
+			return *this;
+		}
+
+		// rereads a single cell of the zone after it was written
+		template<region_e Region, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<sample_index_t> update(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			return set(position, zone.template within<Region>(position) && zone[position] == value);
+		}
+
+		// blockages held here, such as standing entities, are excluded without any rejection
+		inline ref<sample_index_t> block(offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			const usize index{ flatten(position) };
+
+			if (blocks[index] != 0) {
+				return *this;
+			}
+
+			const bool was{ eligible(index) };
+
+			blocks[index] = 1;
+
+			if (was) {
+				exclude(index);
+			}
+
+			return *this;
+		}
+
+		inline ref<sample_index_t> unblock(offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			const usize index{ flatten(position) };
+
+			if (blocks[index] == 0) {
+				return *this;
+			}
+
+			blocks[index] = 0;
+
+			if (eligible(index)) {
+				include(index);
+			}
+
+			return *this;
+		}
+
+		inline ref<sample_index_t> move_block(offset_t from, offset_t to) noexcept {
+			unblock(from);
+			block(to);
+
+			return *this;
+		}
+
+		inline ref<sample_index_t> clear_blocks() noexcept {
+			for (usize i{ 0 }; i < area; ++i) {
+				if (blocks[i] == 0) {
+					continue;
+				}
+
+				blocks[i] = 0;
+
+				if (eligible(i)) {
+					include(i);
+				}
+			}
+
+			return *this;
+		}
+
+		// a uniformly random eligible cell, or nullopt only if there is none
+		template<RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		inline std::optional<offset_t> sample(ref<Randomizer> generator) const noexcept {
+			if (total == 0) {
+				return std::nullopt;
+			}
+
+			return unflatten(draw(generator));
+		}
+
+		// as above while also avoiding blockages kept elsewhere; each rejected cell is withdrawn until the draw ends, so the result stays uniform and a free cell is always found if one exists
+		template<RandomEngine Randomizer, SparseBlockage... Blockages>
+			requires is_random_engine<Randomizer>::value && (sizeof...(Blockages) > 0)
+		inline std::optional<offset_t> sample(ref<Randomizer> generator, cref<Blockages>... blockages) noexcept {
+			std::optional<offset_t> result{ std::nullopt };
+
+			withdrawn.clear();
+
+			while (total > 0) {
+				const usize index{ draw(generator) };
+				const offset_t position{ unflatten(index) };
+
+				if (!(blockages.contains(position) || ...)) {
+					result = position;
+
+					break;
+				}
+
+				exclude(index);
+				withdrawn.push_back(index);
+			}
+
+			for (cauto index : withdrawn) {
+				include(index);
+			}
+
+			return result;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	// a view cone in degrees clockwise from north, matching arc_t; a nan angle or span covers the full circle
+	struct sector_t {
+	  private:
+		f64 facing_x;
+		f64 facing_y;
+
+		// the squared cosine of half the span, signed like the cosine itself
+		f64 threshold;
+
+		bool whole;
+
+	  public:
+		constexpr sector_t() noexcept : facing_x{ 0.0 }, facing_y{ 0.0 }, threshold{ -1.0 }, whole{ true } {}
+
+		inline sector_t(f64 angle, f64 span) noexcept : facing_x{ 0.0 }, facing_y{ 0.0 }, threshold{ -1.0 }, whole{ std::isnan(angle) || std::isnan(span) || span >= 360.0 } {
+			if (whole) {
+				return;
+			}
+
+			const f64 facing{ (angle - 90.0) * std::numbers::pi / 180.0 };
+			const f64 cosine{ std::cos(std::max(span, 0.0) * 0.5 * std::numbers::pi / 180.0) };
+
+			facing_x = std::cos(facing);
+			facing_y = std::sin(facing);
+
+			threshold = cosine < 0.0 ? -cosine * cosine : cosine * cosine;
+		}
+
+		// whether a cell at the given offset from the viewer lies within half the span of the facing
+		constexpr bool contains(offset_t delta) const noexcept {
+			if (whole || (delta.x == 0 && delta.y == 0)) {
+				return true;
+			}
+
+			const f64 dot{ delta.x * facing_x + delta.y * facing_y };
+			const f64 length{ static_cast<f64>(delta.x) * delta.x + static_cast<f64>(delta.y) * delta.y };
+
+			if (threshold >= 0.0) {
+				return dot >= 0.0 && dot * dot >= threshold * length;
+			}
+
+			return dot >= 0.0 || dot * dot <= -threshold * length;
+		}
+	};
+
+	// symmetric shadowcasting over exact rational slopes, scanning each quadrant row by row from an explicit stack
+	struct shadowcaster_t {
+	  private:
+		struct slope_t {
+			i32 numerator;
+			i32 denominator;
+		};
+
+		struct row_t {
+			i32 depth;
+
+			slope_t start;
+			slope_t end;
+		};
+
+		// the offsets one column across and one row outward in each quadrant
+		struct transform_t {
+			offset_t column;
+			offset_t depth;
+		};
+
+		static constexpr transform_t transforms[]{
+			transform_t{ offset_t{ 1, 0 }, offset_t{ 0, -1 } },
+			transform_t{ offset_t{ 0, 1 }, offset_t{ 1, 0 } },
+			transform_t{ offset_t{ 1, 0 }, offset_t{ 0, 1 } },
+			transform_t{ offset_t{ 0, 1 }, offset_t{ -1, 0 } },
+		};
+
+		std::vector<row_t> rows;
+
+		// the widest column within the radius at each depth, kept until the radius changes
+		std::vector<i32> reach;
+		f64 reach_radius;
+
+		static constexpr i32 floor_div(i32 numerator, i32 denominator) noexcept { return numerator >= 0 ? numerator / denominator : -((-numerator + denominator - 1) / denominator); }
+
+		static constexpr i32 ceil_div(i32 numerator, i32 denominator) noexcept { return -floor_div(-numerator, denominator); }
+
+		// the first column whose centre lies at or past the start slope, rounding ties outward
+		static constexpr i32 first_column(cref<row_t> row) noexcept { return floor_div(2 * row.depth * row.start.numerator + row.start.denominator, 2 * row.start.denominator); }
+
+		static constexpr i32 last_column(cref<row_t> row) noexcept { return ceil_div(2 * row.depth * row.end.numerator - row.end.denominator, 2 * row.end.denominator); }
+
+		// a floor cell is seen only if its centre lies within the row's slopes, which makes sight between any two floor cells mutual
+		static constexpr bool is_symmetric(cref<row_t> row, i32 column) noexcept { return column * row.start.denominator >= row.depth * row.start.numerator && column * row.end.denominator <= row.depth * row.end.numerator; }
+
+		template<extent_t Size> static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		inline void measure(f64 radius) noexcept {
+			if (radius == reach_radius && !reach.empty()) {
+				return;
+			}
+
+			reach_radius = radius;
+
+			const i32 limit{ static_cast<i32>(radius) };
+
+			reach.resize(static_cast<usize>(limit) + 1);
+
+			for (i32 depth{ 0 }; depth <= limit; ++depth) {
+				reach[static_cast<usize>(depth)] = static_cast<i32>(std::sqrt(radius * radius - static_cast<f64>(depth) * depth));
+			}
+		}
+
+	  public:
+		inline shadowcaster_t() noexcept : rows{}, reach{}, reach_radius{ 0.0 } {}
+
+		// scratch for callers without their own caster; one per thread so that concurrent casts never share rows
+		static inline ref<shadowcaster_t> local() noexcept {
+			static thread_local shadowcaster_t caster{};
+
+			return caster;
+		}
+
+		// reveals the origin and every cell within the radius that it can see; cells on the quadrant axes may be revealed twice
+		template<extent_t Size, typename Opaque, typename Reveal> inline void cast(offset_t origin, f64 radius, Opaque opaque, Reveal reveal) noexcept {
+			if (!contains<Size>(origin)) {
+				return;
+			}
+
+			reveal(origin);
+
+			if (radius < 1.0) {
+				return;
+			}
+
+			measure(radius);
+
+			const i32 limit{ static_cast<i32>(reach.size()) - 1 };
+
+			for (cref<transform_t> transform : transforms) {
+				rows.clear();
+				rows.push_back(row_t{ 1, slope_t{ -1, 1 }, slope_t{ 1, 1 } });
+
+				while (!rows.empty()) {
+					row_t row{ rows.back() };
+					rows.pop_back();
+
+					const i32 width{ reach[static_cast<usize>(row.depth)] };
+					const i32 last{ last_column(row) };
+
+					// unset until the first cell, then whether the previous cell blocked sight
+					i8 previous{ -1 };
+
+					for (i32 column{ first_column(row) }; column <= last; ++column) {
+						const offset_t position{ origin.x + transform.column.x * column + transform.depth.x * row.depth, origin.y + transform.column.y * column + transform.depth.y * row.depth };
+
+						const bool within{ contains<Size>(position) };
+						const bool blocked{ !within || opaque(position) };
+
+						if (within && std::abs(column) <= width && (blocked || is_symmetric(row, column))) {
+							reveal(position);
+						}
+
+						if (previous == 1 && !blocked) {
+							row.start = slope_t{ 2 * column - 1, 2 * row.depth };
+						} else if (previous == 0 && blocked && row.depth < limit) {
+							rows.push_back(row_t{ row.depth + 1, row.start, slope_t{ 2 * column - 1, 2 * row.depth } });
+						}
+
+						previous = blocked ? 1 : 0;
+					}
+
+					if (previous == 0 && row.depth < limit) {
+						rows.push_back(row_t{ row.depth + 1, row.start, row.end });
+					}
+				}
+			}
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// clips a rect to the zone as half-open corners, empty if they cross
+	template<extent_t Size> struct summed_window_t {
+		i32 min_x;
+		i32 min_y;
+		i32 max_x;
+		i32 max_y;
+
+		static constexpr summed_window_t clip(cref<rect_t> rect) noexcept {
+			return summed_window_t{
+				std::max<i32>(rect.position.x, 0),
+				std::max<i32>(rect.position.y, 0),
+				std::min<i32>(rect.position.x + rect.size.w, Size.w),
+				std::min<i32>(rect.position.y + rect.size.h, Size.h),
+			};
+		}
+
+		constexpr bool empty() const noexcept { return min_x >= max_x || min_y >= max_y; }
+
+		constexpr usize area() const noexcept { return empty() ? 0 : static_cast<usize>(max_x - min_x) * static_cast<usize>(max_y - min_y); }
+	};
+
+	// integral image of the cells matching a value, answering rectangle counts in constant time until the zone changes
+	template<extent_t Size> struct summed_area_t {
+		using sum_t = u32;
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+	  private:
+		using window_t = summed_window_t<Size>;
+
+		static constexpr usize stride{ static_cast<usize>(Size.w) + 1 };
+
+		// one extra leading row and column of zeroes so that no query needs a bounds branch
+		std::vector<sum_t> sums;
+
+		std::vector<sum_t> row;
+
+		constexpr sum_t corner(i32 x, i32 y) const noexcept { return sums[static_cast<usize>(y) * stride + static_cast<usize>(x)]; }
+
+		constexpr usize sum(cref<window_t> window) const noexcept {
+			if (window.empty()) {
+				return 0;
+			}
+
+			return corner(window.max_x, window.max_y) - corner(window.min_x, window.max_y) - corner(window.max_x, window.min_y) + corner(window.min_x, window.min_y);
+		}
+
+		// flags a row, scans it, then adds the row above in a separate pass the compiler can vectorize
+		template<typename T, extent_t BorderSize, typename Predicate> inline void tabulate(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			std::fill(sums.begin(), sums.begin() + stride, sum_t{ 0 });
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					row[x] = predicate(zone[offset_t{ x, y }]) ? 1 : 0;
+				}
+
+				std::inclusive_scan(row.begin(), row.end(), row.begin());
+
+				cptr<sum_t> above{ sums.data() + static_cast<usize>(y) * stride + 1 };
+				ptr<sum_t> current{ sums.data() + static_cast<usize>(y + 1) * stride + 1 };
+
+				current[-1] = 0;
+
+				for (usize x{ 0 }; x < static_cast<usize>(Size.w); ++x) {
+					current[x] = above[x] + row[x];
+				}
+			}
+		}
+
+	  public:
+		inline summed_area_t() noexcept : sums(stride * (static_cast<usize>(Size.h) + 1), 0), row(static_cast<usize>(Size.w), 0) {}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline summed_area_t(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept : summed_area_t{} {
+			build(zone, value);
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<summed_area_t> build(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			tabulate(zone, [&](cref<T> cell) -> bool { return cell == value; });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename Predicate> inline ref<summed_area_t> build_if(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			tabulate(zone, predicate);
+
+			return *this;
+		}
+
+		inline usize count() const noexcept { return corner(Size.w, Size.h); }
+
+		// matching cells within the rect, clipped to the zone
+		inline usize count(cref<rect_t> rect) const noexcept { return sum(window_t::clip(rect)); }
+
+		// matching cells between two inclusive corners
+		inline usize count(offset_t origin, offset_t extent) const noexcept { return count(rect_t{ origin, extent_t{ extent.x - origin.x + 1, extent.y - origin.y + 1 } }); }
+
+		inline bool contains(cref<rect_t> rect) const noexcept { return count(rect) > 0; }
+
+		// whether every cell of the rect within the zone matches
+		inline bool covers(cref<rect_t> rect) const noexcept {
+			const window_t window{ window_t::clip(rect) };
+
+			return sum(window) == window.area();
+		}
+
+		inline bool operator[](offset_t position) const noexcept { return count(rect_t{ position, extent_t{ 1, 1 } }) > 0; }
+	};
+
+	// two dimensional fenwick tree over the cells matching a value, for zones that change a few cells between queries
+	template<extent_t Size> struct fenwick_area_t {
+		using sum_t = u32;
+
+		static constexpr extent_t size{ Size };
+
+		static constexpr usize area{ static_cast<usize>(Size.area()) };
+
+	  private:
+		using window_t = summed_window_t<Size>;
+
+		static constexpr usize stride{ static_cast<usize>(Size.w) + 1 };
+
+		// one based in both axes; unsigned sums wrap on removal but every prefix is still exact
+		std::vector<sum_t> tree;
+
+		std::vector<u8> flags;
+
+		static constexpr usize flatten(offset_t position) noexcept { return static_cast<usize>(position.y) * static_cast<usize>(Size.w) + static_cast<usize>(position.x); }
+
+		static constexpr bool contains(offset_t position) noexcept { return position.x >= 0 && position.y >= 0 && position.x < Size.w && position.y < Size.h; }
+
+		static constexpr i32 lowest(i32 index) noexcept { return index & -index; }
+
+		// matching cells in the half-open rect from the origin to the corner
+		constexpr sum_t prefix(i32 x, i32 y) const noexcept {
+			sum_t total{ 0 };
+
+			for (i32 j{ y }; j > 0; j -= lowest(j)) {
+				for (i32 i{ x }; i > 0; i -= lowest(i)) {
+					total += tree[static_cast<usize>(j) * stride + static_cast<usize>(i)];
+				}
+			}
+
+			return total;
+		}
+
+		constexpr void add(offset_t position, sum_t delta) noexcept {
+			for (i32 j{ position.y + 1 }; j <= Size.h; j += lowest(j)) {
+				for (i32 i{ position.x + 1 }; i <= Size.w; i += lowest(i)) {
+					tree[static_cast<usize>(j) * stride + static_cast<usize>(i)] += delta;
+				}
+			}
+		}
+
+		constexpr usize sum(cref<window_t> window) const noexcept {
+			if (window.empty()) {
+				return 0;
+			}
+
+			return prefix(window.max_x, window.max_y) - prefix(window.min_x, window.max_y) - prefix(window.max_x, window.min_y) + prefix(window.min_x, window.min_y);
+		}
+
+		// fills the leaves and pushes each node into its parent along x and then along y, linear rather than a point update per cell
+		template<typename T, extent_t BorderSize, typename Predicate> inline void tabulate(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			std::fill(tree.begin(), tree.end(), sum_t{ 0 });
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					const offset_t position{ x, y };
+
+					flags[flatten(position)] = predicate(zone[position]) ? 1 : 0;
+
+					tree[static_cast<usize>(y + 1) * stride + static_cast<usize>(x + 1)] = flags[flatten(position)];
+				}
+			}
+
+			for (i32 j{ 1 }; j <= Size.h; ++j) {
+				for (i32 i{ 1 }; i <= Size.w; ++i) {
+					const i32 parent{ i + lowest(i) };
+
+					if (parent <= Size.w) {
+						tree[static_cast<usize>(j) * stride + static_cast<usize>(parent)] += tree[static_cast<usize>(j) * stride + static_cast<usize>(i)];
+					}
+				}
+			}
+
+			for (i32 j{ 1 }; j <= Size.h; ++j) {
+				const i32 parent{ j + lowest(j) };
+
+				if (parent > Size.h) {
+					continue;
+				}
+
+				for (usize i{ 1 }; i < stride; ++i) {
+					tree[static_cast<usize>(parent) * stride + i] += tree[static_cast<usize>(j) * stride + i];
+				}
+			}
+		}
+
+	  public:
+		inline fenwick_area_t() noexcept : tree(stride * (static_cast<usize>(Size.h) + 1), 0), flags(area, 0) {}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline fenwick_area_t(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept : fenwick_area_t{} {
+			build(zone, value);
+		}
+
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<fenwick_area_t> build(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			tabulate(zone, [&](cref<T> cell) -> bool { return cell == value; });
+
+			return *this;
+		}
+
+		template<typename T, extent_t BorderSize, typename Predicate> inline ref<fenwick_area_t> build_if(cref<zone_t<T, Size, BorderSize>> zone, Predicate predicate) noexcept {
+			tabulate(zone, predicate);
+
+			return *this;
+		}
+
+		// records whether a cell now matches; repeated calls with the same state are no-ops
+		inline ref<fenwick_area_t> set(offset_t position, bool match) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			ref<u8> flag{ flags[flatten(position)] };
+
+			if (static_cast<bool>(flag) == match) {
+				return *this;
+			}
+
+			flag = match ? 1 : 0;
+
+			add(position, match ? sum_t{ 1 } : static_cast<sum_t>(-1));
+
+			return *this;
+		}
+
+		// rereads a single cell of the zone after it was written
+		template<typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value
+		inline ref<fenwick_area_t> update(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, offset_t position) noexcept {
+			if (!contains(position)) {
+				return *this;
+			}
+
+			return set(position, zone[position] == value);
+		}
+
+		inline usize count() const noexcept { return prefix(Size.w, Size.h); }
+
+		// matching cells within the rect, clipped to the zone
+		inline usize count(cref<rect_t> rect) const noexcept { return sum(window_t::clip(rect)); }
+
+		// matching cells between two inclusive corners
+		inline usize count(offset_t origin, offset_t extent) const noexcept { return count(rect_t{ origin, extent_t{ extent.x - origin.x + 1, extent.y - origin.y + 1 } }); }
+
+		inline bool contains(cref<rect_t> rect) const noexcept { return count(rect) > 0; }
+
+		// whether every cell of the rect within the zone matches
+		inline bool covers(cref<rect_t> rect) const noexcept {
+			const window_t window{ window_t::clip(rect) };
+
+			return sum(window) == window.area();
+		}
+
+		inline bool operator[](offset_t position) const noexcept { return flags[flatten(position)] != 0; }
+	};
+} // namespace bleak
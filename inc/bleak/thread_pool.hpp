@@ -0,0 +1,178 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bleak {
+	struct thread_pool_t {
+	  private:
+		// everything a worker reads while running one parallel_for; it lives on the caller's stack until every worker that took it has checked out
+		struct batch_t {
+			std::function<void(usize)> job;
+			usize count;
+
+			std::atomic<usize> cursor;
+
+			usize pending;
+			usize holders;
+		};
+
+		std::vector<std::thread> threads{};
+
+		std::mutex dispatch{};
+
+		std::mutex access{};
+		std::condition_variable wake{};
+		std::condition_variable finished{};
+
+		// the open batch, or null once its caller has retired it
+		ptr<batch_t> current{ nullptr };
+
+		usize generation{ 0 };
+
+		bool stopping{ false };
+
+		static inline thread_local bool within_pool{ false };
+
+		inline void run(ref<batch_t> batch) noexcept {
+			usize completed{ 0 };
+
+			for (usize index{ batch.cursor.fetch_add(1, std::memory_order_relaxed) }; index < batch.count; index = batch.cursor.fetch_add(1, std::memory_order_relaxed)) {
+				batch.job(index);
+				++completed;
+			}
+
+			if (completed == 0) {
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock{ access };
+
+			batch.pending -= completed;
+
+			if (batch.pending == 0) {
+				finished.notify_all();
+			}
+		}
+
+		inline void work() noexcept {
+			within_pool = true;
+
+			usize seen{ 0 };
+
+			for (;;) {
+				ptr<batch_t> batch{ nullptr };
+
+				{
+					std::unique_lock<std::mutex> lock{ access };
+
+					wake.wait(lock, [&]() -> bool { return stopping || generation != seen; });
+
+					if (stopping) {
+						return;
+					}
+
+					seen = generation;
+
+					// woke after the caller already retired this generation
+					if (current == nullptr) {
+						continue;
+					}
+
+					batch = current;
+					++batch->holders;
+				}
+
+				run(*batch);
+
+				std::lock_guard<std::mutex> lock{ access };
+
+				if (--batch->holders == 0) {
+					finished.notify_all();
+				}
+			}
+		}
+
+	  public:
+		inline thread_pool_t() noexcept : thread_pool_t{ std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0 } {}
+
+		inline explicit thread_pool_t(usize workers) noexcept {
+			threads.reserve(workers);
+
+			for (usize i{ 0 }; i < workers; ++i) {
+				threads.emplace_back([this]() { work(); });
+			}
+		}
+
+		inline thread_pool_t(cref<thread_pool_t> other) noexcept = delete;
+		inline ref<thread_pool_t> operator=(cref<thread_pool_t> other) noexcept = delete;
+
+		inline ~thread_pool_t() noexcept {
+			{
+				std::lock_guard<std::mutex> lock{ access };
+				stopping = true;
+			}
+
+			wake.notify_all();
+
+			for (ref<std::thread> thread : threads) {
+				thread.join();
+			}
+		}
+
+		// the calling thread participates, so a pool of n workers runs n + 1 tasks at once
+		inline usize concurrency() const noexcept { return threads.size() + 1; }
+
+		// invokes func(i) for every i in [0, count) and blocks until all have returned; nested calls run inline
+		template<typename Func> inline void parallel_for(usize count, rval<Func> func) noexcept {
+			if (count == 0) {
+				return;
+			}
+
+			if (threads.empty() || count == 1 || within_pool) {
+				for (usize i{ 0 }; i < count; ++i) {
+					func(i);
+				}
+
+				return;
+			}
+
+			std::lock_guard<std::mutex> dispatch_lock{ dispatch };
+
+			batch_t batch{ [&func](usize index) { func(index); }, count, 0, count, 0 };
+
+			{
+				std::lock_guard<std::mutex> lock{ access };
+
+				current = &batch;
+
+				++generation;
+			}
+
+			wake.notify_all();
+
+			within_pool = true;
+			run(batch);
+			within_pool = false;
+
+			std::unique_lock<std::mutex> lock{ access };
+
+			finished.wait(lock, [&]() -> bool { return batch.pending == 0 && batch.holders == 0; });
+
+			// retired under the same lock, so no worker can take the batch once it leaves scope
+			current = nullptr;
+		}
+
+		static inline ref<thread_pool_t> shared() noexcept {
+			static thread_pool_t pool{};
+
+			return pool;
+		}
+	};
+} // namespace bleak
@@ -2,6 +2,7 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -13,6 +14,7 @@
 #include <bleak/applicator.hpp>
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
+#include <bleak/bitboard.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
 #include <bleak/concepts.hpp>
@@ -25,6 +27,7 @@
 #include <bleak/sparse.hpp>
 #include <bleak/random.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/thread_pool.hpp>
 
 #include <bleak/constants/enums.hpp>
 #include <bleak/constants/numeric.hpp>
@@ -39,6 +42,185 @@ namespace bleak {
 	  private:
 		array_t<T, Size> cells;
 
+		template<region_e Region> static constexpr bitboard_t<Size> region_mask() noexcept {
+			bitboard_t<Size> mask{};
+
+			each_span<Region>(0, zone_size.h, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) { mask.set(y, begin, end); });
+
+			return mask;
+		}
+
+		// packed equivalent of iterating modulate and swap; written planes track which cells each array would have had assigned
+		template<region_e Region, typename U>
+			requires is_equatable<T, U>::value && std::is_assignable<ref<T>, U>::value
+		constexpr void automatize_packed(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			const bitboard_t<Size> region{ region_mask<Region>() };
+
+			bitboard_t<Size> current{};
+			bitboard_t<Size> next{};
+
+			current.pack(cells, true_value);
+			next.pack(buffer, true_value);
+
+			bitboard_t<Size> current_written{};
+			bitboard_t<Size> next_written{};
+
+			bitboard_t<Size> above{};
+			bitboard_t<Size> below{};
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				bitboard_t<Size>::compare(current, threshold, above, below);
+
+				for (usize k{ 0 }; k < bitboard_t<Size>::word_count; ++k) {
+					const u64 changed{ (above[k] | below[k]) & region[k] };
+
+					next[k] = (next[k] & ~changed) | (above[k] & region[k]);
+					next_written[k] |= changed;
+				}
+
+				current.swap(next);
+				current_written.swap(next_written);
+			}
+
+			if (iterations % 2 != 0) {
+				swap(buffer);
+			}
+
+			current.unpack(cells, current_written, true_value, false_state);
+			next.unpack(buffer, next_written, true_value, false_state);
+		}
+
+		template<region_e Region, typename U>
+			requires std::is_assignable<ref<T>, U>::value
+		constexpr void automatize_band(ref<array_t<T, Size>> buffer, extent_t::scalar_t first_row, extent_t::scalar_t last_row, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
+			each_safe_span<Region>(first_row, last_row, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					modulate<decltype(safe)::value>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+				}
+			});
+		}
+
+		// each band reads the shared cells and writes only its own rows of buffer, so the result matches the serial sweep exactly
+		template<region_e Region, typename U>
+			requires std::is_assignable<ref<T>, U>::value
+		constexpr void automatize_parallel(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			ref<thread_pool_t> pool{ thread_pool_t::shared() };
+
+			const usize bands{ std::min<usize>(pool.concurrency() * 4, static_cast<usize>(zone_size.h)) };
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				pool.parallel_for(bands, [&](usize band) {
+					const extent_t::scalar_t first_row{ static_cast<extent_t::scalar_t>(band * zone_size.h / bands) };
+					const extent_t::scalar_t last_row{ static_cast<extent_t::scalar_t>((band + 1) * zone_size.h / bands) };
+
+					automatize_band<Region>(buffer, first_row, last_row, threshold, true_value, false_state);
+				});
+
+				swap(buffer);
+			}
+		}
+
+		// splits a region into contiguous row spans of [begin, end) so that callers iterate without per-cell region tests; a visitor returning false ends the walk, which then returns false
+		template<region_e Region, typename Visitor> static constexpr bool each_span(extent_t::scalar_t first_row, extent_t::scalar_t last_row, Visitor visitor) noexcept {
+			cauto visit{ [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) -> bool {
+				if constexpr (std::is_same<std::invoke_result_t<ref<Visitor>, extent_t::scalar_t, extent_t::scalar_t, extent_t::scalar_t>, bool>::value) {
+					return visitor(y, begin, end);
+				} else {
+					visitor(y, begin, end);
+
+					return true;
+				}
+			} };
+
+			for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+				if constexpr (Region == region_e::All) {
+					if (!visit(y, extent_t::scalar_t{ 0 }, zone_size.w)) {
+						return false;
+					}
+				} else if constexpr (Region == region_e::Interior) {
+					if (y < interior_origin.y || y > interior_extent.y || interior_origin.x > interior_extent.x) {
+						continue;
+					}
+
+					if (!visit(y, interior_origin.x, static_cast<extent_t::scalar_t>(interior_extent.x + 1))) {
+						return false;
+					}
+				} else if constexpr (Region == region_e::Border) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						if (!visit(y, extent_t::scalar_t{ 0 }, zone_size.w)) {
+							return false;
+						}
+					} else if (border_size.w > 0) {
+						if (!visit(y, extent_t::scalar_t{ 0 }, border_size.w) || !visit(y, static_cast<extent_t::scalar_t>(std::max<i32>(zone_size.w - border_size.w, border_size.w)), zone_size.w)) {
+							return false;
+						}
+					}
+				}
+			}
+
+			return true;
+		}
+
+		// visits the flat index of every cell in the region, one contiguous run per span so the inner loop can vectorize
+		template<region_e Region, typename Visitor> static constexpr void each_index(Visitor visitor) noexcept {
+			if constexpr (Region == region_e::All) {
+				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
+					visitor(i);
+				}
+			} else {
+				each_span<Region>(0, zone_size.h, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+					const extent_t::product_t row{ static_cast<extent_t::product_t>(y) * zone_size.w };
+
+					for (extent_t::product_t i{ row + begin }; i < row + end; ++i) {
+						visitor(i);
+					}
+				});
+			}
+		}
+
+		// as each_span, but cuts each span at the zone's outer ring and tags the rest std::true_type, where all eight neighbours can be read unchecked
+		template<region_e Region, typename Visitor> static constexpr void each_safe_span(extent_t::scalar_t first_row, extent_t::scalar_t last_row, Visitor visitor) noexcept {
+			each_span<Region>(first_row, last_row, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				const extent_t::scalar_t safe_begin{ std::max<extent_t::scalar_t>(begin, 1) };
+				const extent_t::scalar_t safe_end{ std::min<extent_t::scalar_t>(end, zone_extent.x) };
+
+				if (y == zone_origin.y || y == zone_extent.y || safe_begin >= safe_end) {
+					visitor(std::false_type{}, y, begin, end);
+
+					return;
+				}
+
+				if (begin < safe_begin) {
+					visitor(std::false_type{}, y, begin, safe_begin);
+				}
+
+				visitor(std::true_type{}, y, safe_begin, safe_end);
+
+				if (safe_end < end) {
+					visitor(std::false_type{}, y, safe_end, end);
+				}
+			});
+		}
+
+		// reservoir sweep over the region, so a draw that spends its attempts still returns a uniform match whenever one exists
+		template<region_e Region, RandomEngine Randomizer, typename Accept> constexpr std::optional<offset_t> sweep_random(ref<Randomizer> generator, Accept accept) const noexcept {
+			std::optional<offset_t> result{ std::nullopt };
+
+			usize seen{ 0 };
+
+			each_span<Region>(0, zone_size.h, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					const offset_t pos{ x, y };
+
+					if (accept(pos) && std::uniform_int_distribution<usize>{ 0, seen++ }(generator) == 0) {
+						result = pos;
+					}
+				}
+			});
+
+			return result;
+		}
+
 	  public:
 		static constexpr extent_t zone_size{ Size };
 		static constexpr extent_t border_size{ BorderSize };		
@@ -213,30 +395,9 @@ namespace bleak {
 		}
 
 		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> set(cref<T> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = value;
-							cells[zone_extent.x - i, y] = value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = value;
+			});
 
 			return *this;
 		}
@@ -244,30 +405,9 @@ namespace bleak {
 		template<region_e Region, typename U>
 			requires std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> set(cref<U> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = value;
-							cells[zone_extent.x - i, y] = value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = value;
+			});
 
 			return *this;
 		}
@@ -281,30 +421,9 @@ namespace bleak {
 		template<region_e Region>
 			requires is_operable_unary<T, operator_e::Addition>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<T> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] += value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] += value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] += value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] += value;
-							cells[zone_extent.x - i, y] += value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] += value;
+			});
 
 			return *this;
 		}
@@ -312,31 +431,9 @@ namespace bleak {
 		template<region_e Region, typename U>
 			requires is_operable<T, U, operator_e::Addition>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<U> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					assert(i < zone_area);
-					cells[i] += value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] += value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] += value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] += value;
-							cells[zone_extent.x - i, y] += value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] += value;
+			});
 
 			return *this;
 		}
@@ -344,38 +441,11 @@ namespace bleak {
 		template<region_e Region, typename... Params>
 			requires(is_operable<T, Params, operator_e::Addition>::value, ...) && is_plurary<Params...>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> apply(cref<Params>... values) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					for (auto value : { values... }) {
-						cells[i] += value;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						for (auto value : { values... }) {
-							cells[x, y] += value;
-						}
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							for (auto value : { values... }) {
-								cells[x, y] += value;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							for (auto value : { values... }) {
-								cells[i, y] += value;
-								cells[zone_extent.x - i, y] += value;
-							}
-						}
-					}
+			each_index<Region>([&](extent_t::product_t i) {
+				for (auto value : { values... }) {
+					cells[i] += value;
 				}
-			}
+			});
 
 			return *this;
 		}
@@ -383,30 +453,9 @@ namespace bleak {
 		template<region_e Region>
 			requires is_operable_unary<T, operator_e::Subtraction>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<T> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] -= value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] -= value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] -= value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] -= value;
-							cells[zone_extent.x - i, y] -= value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] -= value;
+			});
 
 			return *this;
 		}
@@ -414,30 +463,9 @@ namespace bleak {
 		template<region_e Region, typename U>
 			requires is_operable<T, U, operator_e::Subtraction>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<U> value) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] -= value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] -= value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] -= value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] -= value;
-							cells[zone_extent.x - i, y] -= value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] -= value;
+			});
 
 			return *this;
 		}
@@ -445,38 +473,11 @@ namespace bleak {
 		template<region_e Region, typename... Params>
 			requires(is_operable<T, Params, operator_e::Subtraction>::value, ...) && is_plurary<Params...>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> repeal(cref<Params>... values) noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					for (auto value : { values... }) {
-						cells[i] -= value;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						for (auto value : { values... }) {
-							cells[x, y] -= value;
-						}
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							for (auto value : { values... }) {
-								cells[x, y] -= value;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							for (auto value : { values... }) {
-								cells[i, y] -= value;
-								cells[zone_extent.x - i, y] -= value;
-							}
-						}
-					}
+			each_index<Region>([&](extent_t::product_t i) {
+				for (auto value : { values... }) {
+					cells[i] -= value;
 				}
-			}
+			});
 
 			return *this;
 		}
@@ -504,30 +505,9 @@ namespace bleak {
 				return *this;
 			}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
-							cells[zone_extent.x - i, y] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = T::dependent randomizer<Randomizer>::dependent operator()<U>(generator);
+			});
 
 			return *this;
 		}
@@ -541,30 +521,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = dis(generator) ? true_value : false_value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = dis(generator) ? true_value : false_value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = dis(generator) ? true_value : false_value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = dis(generator) ? true_value : false_value;
-							cells[zone_extent.x - i, y] = dis(generator) ? true_value : false_value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = dis(generator) ? true_value : false_value;
+			});
 
 			return *this;
 		}
@@ -578,30 +537,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = dis(generator) ? true_value : false_value;
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = dis(generator) ? true_value : false_value;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = dis(generator) ? true_value : false_value;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = dis(generator) ? true_value : false_value;
-							cells[zone_extent.x - i, y] = dis(generator) ? true_value : false_value;
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = dis(generator) ? true_value : false_value;
+			});
 
 			return *this;
 		}
@@ -615,30 +553,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = applicator(generator, dis);
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = applicator(generator, dis);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = applicator(generator, dis);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = applicator(generator, dis);
-							cells[zone_extent.x - i, y] = applicator(generator, dis);
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = applicator(generator, dis);
+			});
 
 			return *this;
 		}
@@ -652,30 +569,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = applicator(generator, dis);
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = applicator(generator, dis);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = applicator(generator, dis);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = applicator(generator, dis);
-							cells[zone_extent.x - i, y] = applicator(generator, dis);
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = applicator(generator, dis);
+			});
 
 			return *this;
 		}
@@ -689,30 +585,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = applicator(generator, dis);
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = applicator(generator, dis);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = applicator(generator, dis);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = applicator(generator, dis);
-							cells[zone_extent.x - i, y] = applicator(generator, dis);
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = applicator(generator, dis);
+			});
 
 			spoke<Region>(applicator.false_value, spokes);
 
@@ -728,30 +603,9 @@ namespace bleak {
 
 			auto dis{ std::bernoulli_distribution{ fill_percent } };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					cells[i] = applicator(generator, dis);
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						cells[x, y] = applicator(generator, dis);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							cells[x, y] = applicator(generator, dis);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							cells[i, y] = applicator(generator, dis);
-							cells[zone_extent.x - i, y] = applicator(generator, dis);
-						}
-					}
-				}
-			}
+			each_index<Region>([&](extent_t::product_t i) {
+				cells[i] = applicator(generator, dis);
+			});
 
 			spoke<Region>(applicator.false_value, spokes);
 
@@ -1186,69 +1040,22 @@ namespace bleak {
 
 		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> collapse(cref<T> value, usize index, cref<T> collapse_to) noexcept {
 			if constexpr (Region == region_e::None) {
-				return *this;
-			}
-
-			array_t<T, Size> buffer{ cells };
-
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
-
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
-
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
-
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
-
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
-
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
-
-							buffer[inner_position] = collapse_to;
+				return *this;
+			}
 
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
+			array_t<T, Size> buffer{ cells };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					const offset_t position{ x, y };
 
-							buffer[outer_position] = collapse_to;
-						}
+					if (cells[position] != value || calculate_index<solver_e::Melded, decltype(safe)::value>(position, value) != index) {
+						continue;
 					}
+
+					buffer[position] = collapse_to;
 				}
-			}
+			});
 
 			swap(buffer);
 
@@ -1264,64 +1071,17 @@ namespace bleak {
 
 			array_t<T, Size> buffer{ cells };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
-
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					const offset_t position{ x, y };
 
-						buffer[position] = collapse_to;
+					if (cells[position] != value || calculate_index<solver_e::Melded, decltype(safe)::value>(position, value) != index) {
+						continue;
 					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
-
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
-
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
-
-							buffer[inner_position] = collapse_to;
-
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
-
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
-
-							buffer[outer_position] = collapse_to;
-						}
-					}
+					buffer[position] = collapse_to;
 				}
-			}
+			});
 
 			swap(buffer);
 
@@ -1335,64 +1095,17 @@ namespace bleak {
 
 			buffer = cells;
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
-
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
-							continue;
-						}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					const offset_t position{ x, y };
 
-						buffer[position] = collapse_to;
+					if (cells[position] != value || calculate_index<solver_e::Melded, decltype(safe)::value>(position, value) != index) {
+						continue;
 					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
-
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
-
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
-
-							buffer[inner_position] = collapse_to;
-
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
-
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
-
-							buffer[outer_position] = collapse_to;
-						}
-					}
+					buffer[position] = collapse_to;
 				}
-			}
+			});
 
 			swap(buffer);
 
@@ -1408,64 +1121,17 @@ namespace bleak {
 
 			buffer = cells;
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-							continue;
-						}
-
-						buffer[position] = collapse_to;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						const offset_t position{ x, y };
-
-						if (cells[position] != value || calculate_index<solver_e::Melded, U, interior_safe>(position, value) != index) {
-							continue;
-						}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					const offset_t position{ x, y };
 
-						buffer[position] = collapse_to;
+					if (cells[position] != value || calculate_index<solver_e::Melded, decltype(safe)::value>(position, value) != index) {
+						continue;
 					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							const offset_t position{ x, y };
-
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
-								continue;
-							}
-
-							buffer[position] = collapse_to;
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
-								goto outer_pos;
-							}
-
-							buffer[inner_position] = collapse_to;
-
-						outer_pos:
-							const offset_t outer_position{ zone_extent.x - i, y };
-
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
-								continue;
-							}
-
-							buffer[outer_position] = collapse_to;
-						}
-					}
+					buffer[position] = collapse_to;
 				}
-			}
+			});
 
 			swap(buffer);
 
@@ -1521,32 +1187,11 @@ namespace bleak {
 				return *this;
 			}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
-					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, true_value, false_state);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, true_value, false_state);
-						}
-					}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					modulate<decltype(safe)::value>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
 				}
-			}
+			});
 
 			return *this;
 		}
@@ -1558,32 +1203,11 @@ namespace bleak {
 				return *this;
 			}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
-					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, true_value, false_state);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, true_value, false_state);
-						}
-					}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					modulate<decltype(safe)::value>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
 				}
-			}
+			});
 
 			return *this;
 		}
@@ -1593,32 +1217,11 @@ namespace bleak {
 				return *this;
 			}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
-					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, applicator);
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, applicator);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, applicator);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, applicator);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
-						}
-					}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					modulate<decltype(safe)::value>(buffer, offset_t{ x, y }, threshold, applicator);
 				}
-			}
+			});
 
 			return *this;
 		}
@@ -1630,41 +1233,32 @@ namespace bleak {
 				return *this;
 			}
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
-					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
-						modulate(buffer, offset_t{ x, y }, threshold, applicator);
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, applicator);
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							modulate(buffer, offset_t{ x, y }, threshold, applicator);
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							modulate(buffer, offset_t{ i, y }, threshold, applicator);
-							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, applicator);
-						}
-					}
+			each_safe_span<Region>(0, zone_size.h, [&](auto safe, extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) {
+				for (extent_t::scalar_t x{ begin }; x < end; ++x) {
+					modulate<decltype(safe)::value>(buffer, offset_t{ x, y }, threshold, applicator);
 				}
-			}
+			});
 
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			if constexpr (Automaton == automaton_e::Packed) {
+				automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
+
+				return *this;
+			}
+
+			if constexpr (Automaton == automaton_e::Parallel) {
+				automatize_parallel<Region>(buffer, iterations, threshold, true_value, false_state);
+
+				return *this;
+			}
+
 			for (u32 i{ 0 }; i < iterations; ++i) {
 				automatize<Region>(buffer, threshold, true_value, false_state);
 				swap(buffer);
@@ -1673,13 +1267,25 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, typename U>
 			requires std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			if constexpr (Automaton == automaton_e::Packed) {
+				automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
+
+				return *this;
+			}
+
+			if constexpr (Automaton == automaton_e::Parallel) {
+				automatize_parallel<Region>(buffer, iterations, threshold, true_value, false_state);
+
+				return *this;
+			}
+
 			for (u32 i{ 0 }; i < iterations; ++i) {
 				automatize<Region>(buffer, threshold, true_value, false_state);
 				swap(buffer);
@@ -1688,11 +1294,23 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar> constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			if constexpr (Automaton == automaton_e::Packed) {
+				automatize_packed<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+
+				return *this;
+			}
+
+			if constexpr (Automaton == automaton_e::Parallel) {
+				automatize_parallel<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+
+				return *this;
+			}
+
 			for (u32 i{ 0 }; i < iterations; ++i) {
 				automatize<Region>(buffer, threshold, applicator);
 				swap(buffer);
@@ -1701,13 +1319,25 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, typename U>
 			requires std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> automatize(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
 				return *this;
 			}
 
+			if constexpr (Automaton == automaton_e::Packed) {
+				automatize_packed<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+
+				return *this;
+			}
+
+			if constexpr (Automaton == automaton_e::Parallel) {
+				automatize_parallel<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+
+				return *this;
+			}
+
 			for (u32 i{ 0 }; i < iterations; ++i) {
 				automatize<Region>(buffer, threshold, applicator);
 				swap(buffer);
@@ -1746,7 +1376,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1757,13 +1387,13 @@ namespace bleak {
 
 			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize<Region, Automaton>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1774,13 +1404,13 @@ namespace bleak {
 
 			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize<Region, Automaton>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1791,13 +1421,13 @@ namespace bleak {
 
 			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region, Automaton>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1808,7 +1438,7 @@ namespace bleak {
 
 			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region, Automaton>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
@@ -1848,7 +1478,7 @@ namespace bleak {
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1859,13 +1489,13 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize<Region, Automaton>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1876,13 +1506,13 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize<Region, Automaton>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1893,13 +1523,13 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region, Automaton>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
 		}
 
-		template<region_e Region, RandomEngine Randomizer, typename U>
+		template<region_e Region, automaton_e Automaton = automaton_e::Scalar, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == region_e::None) {
@@ -1910,7 +1540,7 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region, Automaton>(buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
@@ -1964,7 +1594,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value; });
 		}
 
 		template<region_e Region, RandomEngine Randomizer, typename U>
@@ -1981,8 +1611,6 @@ namespace bleak {
 						return pos;
 					}
 				}
-
-				return std::nullopt;
 			} else if constexpr (Region == region_e::Interior) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ interior_origin.x, interior_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ interior_origin.y, interior_extent.y };
@@ -2013,7 +1641,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value; });
 		}
 
 		template<region_e Region, RandomEngine Randomizer, SparseBlockage Blockage>
@@ -2070,7 +1698,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value && !sparse_blockage.contains(pos); });
 		}
 
 		template<region_e Region, RandomEngine Randomizer, typename U, SparseBlockage Blockage>
@@ -2127,7 +1755,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value && !sparse_blockage.contains(pos); });
 		}
 
 		template<region_e Region, RandomEngine Randomizer, SparseBlockage EntityBlockage, SparseBlockage ObjectBlockage>
@@ -2183,7 +1811,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value && !(entity_blockage.contains(pos) || object_blockage.contains(pos)); });
 		}
 
 		template<region_e Region, RandomEngine Randomizer, typename U, SparseBlockage... Blockages>
@@ -2240,7 +1868,7 @@ namespace bleak {
 				}
 			}
 
-			return std::nullopt;
+			return sweep_random<Region>(generator, [&](offset_t pos) -> bool { return cells[pos] == value && !(blockages.contains(pos) || ...); });
 		}
 
 		template<region_e Region> constexpr void linear_apply(offset_t origin, offset_t target, cref<T> value) noexcept {
@@ -2508,42 +2136,11 @@ namespace bleak {
 		template<region_e Region> constexpr u32 count(cref<T> value) const noexcept {
 			u32 total{ 0 };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						++total;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							++total;
-						}
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								++total;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								++total;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								++total;
-							}
-						}
-					}
+			each_index<Region>([&](extent_t::product_t i) {
+				if (cells[i] == value) {
+					++total;
 				}
-			} else if constexpr (Region == region_e::None) {
-				return 0;
-			}
+			});
 
 			return total;
 		}
@@ -2553,140 +2150,45 @@ namespace bleak {
 		constexpr u32 count(cref<U> value) const noexcept {
 			u32 total{ 0 };
 
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						++total;
-					}
-				}
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							++total;
-						}
-					}
-				}
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								++total;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								++total;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								++total;
-							}
-						}
-					}
+			each_index<Region>([&](extent_t::product_t i) {
+				if (cells[i] == value) {
+					++total;
 				}
-			} else if constexpr (Region == region_e::None) {
-				return 0;
-			}
+			});
 
 			return total;
 		}
 
 		template<region_e Region> constexpr u32 contains(cref<T> value) const noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						return true;
-					}
-				}
-
-				return false;
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							return true;
-						}
-					}
-				}
+			// the walk stops at the first match
+			return !each_span<Region>(0, zone_size.h, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) -> bool {
+				const extent_t::product_t row{ static_cast<extent_t::product_t>(y) * zone_size.w };
 
-				return false;
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								return true;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								return true;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								return true;
-							}
-						}
+				for (extent_t::product_t i{ row + begin }; i < row + end; ++i) {
+					if (cells[i] == value) {
+						return false;
 					}
 				}
 
-				return false;
-			} else if constexpr (Region == region_e::None) {
-				return false;
-			}
-
-			return false;
+				return true;
+			});
 		}
 
 		template<region_e Region, typename U>
 			requires is_equatable<T, U>::value
 		constexpr u32 contains(cref<U> value) const noexcept {
-			if constexpr (Region == region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						return true;
-					}
-				}
-
-				return false;
-			} else if constexpr (Region == region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							return true;
-						}
-					}
-				}
+			// the walk stops at the first match
+			return !each_span<Region>(0, zone_size.h, [&](extent_t::scalar_t y, extent_t::scalar_t begin, extent_t::scalar_t end) -> bool {
+				const extent_t::product_t row{ static_cast<extent_t::product_t>(y) * zone_size.w };
 
-				return false;
-			} else if constexpr (Region == region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								return true;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								return true;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								return true;
-							}
-						}
+				for (extent_t::product_t i{ row + begin }; i < row + end; ++i) {
+					if (cells[i] == value) {
+						return false;
 					}
 				}
 
-				return false;
-			} else if constexpr (Region == region_e::None) {
-				return false;
-			}
-
-			return false;
+				return true;
+			});
 		}
 
 		constexpr bool linear_blockage(offset_t origin, offset_t target, cref<T> value, u32 distance) const noexcept {